@@ -2,8 +2,9 @@
 #define BINOMIAL_HEAP_HPP
 
 #include <vector>
-#include <chrono>
 #include <iostream>
+#include "memoryTracker.hpp"
+#include "heapTiming.hpp"
 
 class Binomial_Heap_Node{
     private:
@@ -25,6 +26,10 @@ class Binomial_Heap_Node{
             firstChild=nullptr;
             next = nullptr;
         }
+
+        // Counted under MEM_HEAP_NODES
+        static void* operator new(size_t size){ return trackedAlloc(MEM_HEAP_NODES, size); }
+        static void operator delete(void* p, size_t size){ trackedFree(MEM_HEAP_NODES, p, size); }
 };
 
 class Binomial_Heap{
@@ -123,6 +128,16 @@ class Binomial_Heap{
 
             // Update head
             head = mergedHead;
+            heap->head = nullptr;
+            heap->min = nullptr;
+
+            // Union: link equal degrees, then find the min among the roots
+            // (a tie can make the old min a child, so rescan)
+            linkSameDegreeTrees();
+            min = nullptr;
+            for (Binomial_Heap_Node* cur = head; cur; cur = cur->next) {
+                if (!min || cur->key < min->key) min = cur;
+            }
         }
 
         void linkSameDegreeTrees() {
@@ -175,14 +190,12 @@ class Binomial_Heap{
             }
         }
 
-        /*
+        // Node the next extract_min detaches (nullptr if empty)
         Binomial_Heap_Node* find_min(){
-            find_min_count++;
             return min;
         }
-        */
         void decrease_key(Binomial_Heap_Node* node, int newKey){
-            auto start = std::chrono::high_resolution_clock::now();
+            HeapOpTimer timer(decrease_key_time);
             
             node->key = newKey;
             Binomial_Heap_Node *parent = node->parent;
@@ -199,17 +212,13 @@ class Binomial_Heap{
                 min = node;
             }
             
-            auto end = std::chrono::high_resolution_clock::now();
-            decrease_key_time += std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
             decrease_key_count++;
         }
         
         int extract_min(){
-            auto start = std::chrono::high_resolution_clock::now();
+            HeapOpTimer timer(extract_min_time);
             
             if(!min) {
-                auto end = std::chrono::high_resolution_clock::now();
-                extract_min_time += std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
                 extract_min_count++;
                 return -1;
             }
@@ -253,7 +262,6 @@ class Binomial_Heap{
             Binomial_Heap subTreeHeapTemp;
             subTreeHeapTemp.head = subTreeHeap;
             merge(&subTreeHeapTemp);
-            linkSameDegreeTrees();
             //delete subTreeHeapTemp;
             //update min pointer
             min = nullptr;
@@ -265,8 +273,6 @@ class Binomial_Heap{
                 cur = cur->next;
             }
             
-            auto end = std::chrono::high_resolution_clock::now();
-            extract_min_time += std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
             extract_min_count++;
 
             return minKey;
@@ -298,4 +304,4 @@ class Binomial_Heap{
         }
 };
 
-#endif // BINOMIAL_HEAP_HPP
\ No newline at end of file
+#endif // BINOMIAL_HEAP_HPP
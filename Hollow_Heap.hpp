@@ -0,0 +1,289 @@
+/*
+ * HOLLOW HEAP
+ *
+ * Two-parent hollow heap (Hansen, Kaplan, Tarjan, Zwick). Items live in
+ * nodes; a node whose item has moved or been deleted stays in the structure
+ * as a hollow node and is only destroyed by a later extract_min:
+ *   insert / merge   O(1)  - link with the root
+ *   decrease_key     O(1)  - move the item into a new node linked with the
+ *                    root; the old node goes hollow, nothing is cut
+ *   extract_min      O(log n) amortized - destroy hollow roots, then link
+ *                    roots of equal rank through a rank-indexed array
+ *
+ * A node made by decrease_key adopts the old (now hollow) node as its first
+ * child and takes rank old.rank - 2, so the hollow node has two parents
+ * until one of them is destroyed.
+ *
+ * PUBLIC INTERFACE:
+ * ------------------------------------------------
+ * Hollow_Heap pq;
+ * Hollow_Heap_Item* h = pq.insert(key, vertexId);   // store h for decrease_key
+ * int vertexId = pq.extract_min();                  // -1 if empty
+ * int key = pq.min_key();
+ * pq.decrease_key(h, newKey);
+ * pq.merge(&other);                                 // other becomes empty
+ * pq.print_stats();
+ */
+
+#ifndef HOLLOW_HEAP_HPP
+#define HOLLOW_HEAP_HPP
+
+#include <vector>
+#include <iostream>
+#include <climits>
+#include "memoryTracker.hpp"
+#include "heapTiming.hpp"
+
+class Hollow_Heap_Node;
+
+class Hollow_Heap_Item{
+    public:
+        int vertexId;
+        Hollow_Heap_Node* node; // node currently holding this item
+
+        Hollow_Heap_Item(int vertexId){
+            this->vertexId = vertexId;
+            node = nullptr;
+        }
+
+        static void* operator new(size_t size){ return trackedAlloc(MEM_HEAP_NODES, size); }
+        static void operator delete(void* p, size_t size){ trackedFree(MEM_HEAP_NODES, p, size); }
+};
+
+class Hollow_Heap_Node{
+    public:
+        int key;
+        int rank;
+        Hollow_Heap_Item* item;      // nullptr = hollow
+        Hollow_Heap_Node* child;     // first child
+        Hollow_Heap_Node* next;      // next sibling in the first parent's list
+        Hollow_Heap_Node* ep;        // extra (second) parent, set by decrease_key
+
+        Hollow_Heap_Node(int key, Hollow_Heap_Item* item){
+            this->key = key;
+            this->item = item;
+            rank = 0;
+            child = nullptr;
+            next = nullptr;
+            ep = nullptr;
+            item->node = this;
+        }
+
+        static void* operator new(size_t size){ return trackedAlloc(MEM_HEAP_NODES, size); }
+        static void operator delete(void* p, size_t size){ trackedFree(MEM_HEAP_NODES, p, size); }
+};
+
+class Hollow_Heap{
+    private:
+        Hollow_Heap_Node* root;
+        HeapScratchVector<Hollow_Heap_Node*> byRank; // ranked-link table, reused
+
+    public:
+        // Performance tracking
+        long long extract_min_time = 0;
+        long long decrease_key_time = 0;
+        int insert_count = 0;
+        int extract_min_count = 0;
+        int decrease_key_count = 0;
+        int size = 0;
+        int node_count = 0; // full + hollow nodes
+
+        Hollow_Heap(){
+            root = nullptr;
+        }
+
+        ~Hollow_Heap(){
+            clear();
+        }
+
+        Hollow_Heap(const Hollow_Heap&) = delete;
+        Hollow_Heap& operator=(const Hollow_Heap&) = delete;
+
+        Hollow_Heap_Item* insert(int key, int vertexId){
+            insert_count++;
+            size++;
+            node_count++;
+
+            Hollow_Heap_Item* item = new Hollow_Heap_Item(vertexId);
+            root = meld(root, new Hollow_Heap_Node(key, item));
+            return item;
+        }
+
+        // Links other's root with ours; other is left empty
+        void merge(Hollow_Heap* other){
+            if (!other || other == this) return;
+            root = meld(root, other->root);
+            size += other->size;
+            node_count += other->node_count;
+            other->root = nullptr;
+            other->size = 0;
+            other->node_count = 0;
+        }
+
+        int min_key(){
+            return root ? root->key : INT_MAX;
+        }
+
+        void decrease_key(Hollow_Heap_Item* item, int newKey){
+            HeapOpTimer timer(decrease_key_time);
+            decrease_key_count++;
+
+            Hollow_Heap_Node* u = item->node;
+            if (newKey >= u->key) return;
+            if (u == root){
+                u->key = newKey;
+                return;
+            }
+
+            // The item moves to a new node; u stays behind, hollow, as the
+            // new node's first child (its second parent)
+            Hollow_Heap_Node* v = new Hollow_Heap_Node(newKey, item);
+            node_count++;
+            u->item = nullptr;
+            if (u->rank > 2) v->rank = u->rank - 2;
+            v->child = u;
+            u->ep = v;
+            root = link(v, root);
+        }
+
+        // Removes the minimum and returns its vertex id (-1 if empty)
+        int extract_min(){
+            HeapOpTimer timer(extract_min_time);
+
+            int vertexId = -1;
+            if (root){
+                Hollow_Heap_Item* item = root->item;
+                vertexId = item->vertexId;
+                root->item = nullptr;
+                delete item;
+                size--;
+
+                deleteHollowRoots();
+            }
+
+            extract_min_count++;
+            return vertexId;
+        }
+
+        bool empty(){
+            return root == nullptr;
+        }
+
+        // Frees every node and item still in the heap
+        void clear(){
+            if (!root) return;
+            root->next = nullptr;
+            Hollow_Heap_Node* pending = root; // nodes to destroy, chained by next
+            while (pending){
+                Hollow_Heap_Node* v = pending;
+                pending = pending->next;
+
+                Hollow_Heap_Node* w = v->child;
+                while (w){
+                    Hollow_Heap_Node* u = w;
+                    w = w->next;
+                    if (!u->ep){
+                        u->next = pending;
+                        pending = u;
+                    }
+                    else {
+                        // Second parent: leave u to the other one
+                        if (u->ep == v) w = nullptr;
+                        else u->next = nullptr;
+                        u->ep = nullptr;
+                    }
+                }
+                if (v->item) delete v->item;
+                delete v;
+            }
+            root = nullptr;
+            size = 0;
+            node_count = 0;
+        }
+
+        // Print performance statistics
+        void print_stats() {
+            std::cout << "\n=== Hollow Heap Statistics ===\n";
+            std::cout << "Number of operations:\n";
+            std::cout << "  Insert:       " << insert_count << "\n";
+            std::cout << "  Extract-min:  " << extract_min_count << "\n";
+            std::cout << "  Decrease-key: " << decrease_key_count << "\n";
+            std::cout << "\nTime spent:\n";
+            std::cout << "  Extract-min:  " << extract_min_time / 1000.0 << " μs\n";
+            std::cout << "  Decrease-key: " << decrease_key_time / 1000.0 << " μs\n";
+            std::cout << "==============================\n";
+        }
+
+    private:
+        Hollow_Heap_Node* meld(Hollow_Heap_Node* a, Hollow_Heap_Node* b){
+            if (!a) return b;
+            if (!b) return a;
+            return link(a, b);
+        }
+
+        // Larger key becomes the first child of the smaller; returns the winner
+        Hollow_Heap_Node* link(Hollow_Heap_Node* a, Hollow_Heap_Node* b){
+            if (b->key < a->key) std::swap(a, b);
+            b->next = a->child;
+            a->child = b;
+            return a;
+        }
+
+        // Destroys the hollow root and every hollow node that loses its last
+        // parent on the way; full children are linked by rank as they are
+        // found, and the ranked roots are linked into one tree at the end.
+        void deleteHollowRoots(){
+            int maxRank = -1;
+            Hollow_Heap_Node* pending = root; // hollow nodes to destroy, chained by next
+            pending->next = nullptr;
+
+            while (pending){
+                Hollow_Heap_Node* v = pending;
+                pending = pending->next;
+
+                Hollow_Heap_Node* w = v->child;
+                while (w){
+                    Hollow_Heap_Node* u = w;
+                    w = w->next;
+                    if (!u->item){
+                        if (!u->ep){
+                            u->next = pending;
+                            pending = u;
+                        }
+                        else {
+                            // u keeps its other parent. If that is the first
+                            // parent, the rest of this list is its children.
+                            if (u->ep == v) w = nullptr;
+                            else u->next = nullptr;
+                            u->ep = nullptr;
+                        }
+                    }
+                    else {
+                        // Full child: ranked links with equal-rank roots
+                        while ((int)byRank.size() > u->rank && byRank[u->rank]){
+                            Hollow_Heap_Node* other = byRank[u->rank];
+                            byRank[u->rank] = nullptr;
+                            u = link(u, other);
+                            u->rank++;
+                        }
+                        if ((int)byRank.size() <= u->rank) byRank.resize(u->rank + 1, nullptr);
+                        byRank[u->rank] = u;
+                        if (u->rank > maxRank) maxRank = u->rank;
+                    }
+                }
+                delete v;
+                node_count--;
+            }
+
+            // Unranked links of the surviving roots
+            root = nullptr;
+            for (int r = 0; r <= maxRank; r++){
+                if (byRank[r]){
+                    root = meld(root, byRank[r]);
+                    byRank[r] = nullptr;
+                }
+            }
+        }
+};
+
+#endif // HOLLOW_HEAP_HPP
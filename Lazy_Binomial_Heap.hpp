@@ -0,0 +1,285 @@
+/*
+ * LAZY BINOMIAL HEAP
+ *
+ * Binomial heap that defers all tree linking to extract_min:
+ *   insert / merge   O(1)  - splice into a circular root list, update min
+ *   extract_min      O(log n) amortized - one consolidation pass through a
+ *                    degree-indexed array of roots
+ *   decrease_key     O(log n) - sift up inside the tree
+ *
+ * Handles stay valid across decrease_key: sifting swaps the (key, item)
+ * pairs of two nodes and each item tracks the node currently holding it,
+ * so a handle always refers to the same vertex. extract_min frees the
+ * extracted node and its item.
+ *
+ * PUBLIC INTERFACE:
+ * ------------------------------------------------
+ * Lazy_Binomial_Heap pq;
+ * Lazy_Binomial_Item* h = pq.insert(key, vertexId);   // store h for decrease_key
+ * int vertexId = pq.extract_min();                     // -1 if empty
+ * int key = pq.min_key();
+ * pq.decrease_key(h, newKey);
+ * pq.merge(&other);                                    // other becomes empty
+ * pq.print_stats();
+ */
+
+#ifndef LAZY_BINOMIAL_HEAP_HPP
+#define LAZY_BINOMIAL_HEAP_HPP
+
+#include <vector>
+#include <iostream>
+#include <climits>
+#include "memoryTracker.hpp"
+#include "heapTiming.hpp"
+
+class Lazy_Binomial_Heap_Node;
+
+class Lazy_Binomial_Item{
+    public:
+        int vertexId;
+        Lazy_Binomial_Heap_Node* node; // node currently holding this item
+
+        Lazy_Binomial_Item(int vertexId){
+            this->vertexId = vertexId;
+            node = nullptr;
+        }
+
+        static void* operator new(size_t size){ return trackedAlloc(MEM_HEAP_NODES, size); }
+        static void operator delete(void* p, size_t size){ trackedFree(MEM_HEAP_NODES, p, size); }
+};
+
+class Lazy_Binomial_Heap_Node{
+    public:
+        int key;
+        int degree;
+        Lazy_Binomial_Item* item;
+        Lazy_Binomial_Heap_Node* parent;
+        Lazy_Binomial_Heap_Node* firstChild;
+        Lazy_Binomial_Heap_Node* sibling; // next child of the same parent
+        Lazy_Binomial_Heap_Node* left;    // root list neighbors (circular)
+        Lazy_Binomial_Heap_Node* right;
+
+        Lazy_Binomial_Heap_Node(int key, Lazy_Binomial_Item* item){
+            this->key = key;
+            this->item = item;
+            degree = 0;
+            parent = nullptr;
+            firstChild = nullptr;
+            sibling = nullptr;
+            left = this;
+            right = this;
+            item->node = this;
+        }
+
+        static void* operator new(size_t size){ return trackedAlloc(MEM_HEAP_NODES, size); }
+        static void operator delete(void* p, size_t size){ trackedFree(MEM_HEAP_NODES, p, size); }
+};
+
+class Lazy_Binomial_Heap{
+    private:
+        Lazy_Binomial_Heap_Node* min; // also the entry point of the root list
+        HeapScratchVector<Lazy_Binomial_Heap_Node*> byDegree; // consolidation table, reused
+        HeapScratchVector<Lazy_Binomial_Heap_Node*> roots;    // roots being consolidated, reused
+
+    public:
+        // Performance tracking
+        long long extract_min_time = 0;
+        long long decrease_key_time = 0;
+        int insert_count = 0;
+        int extract_min_count = 0;
+        int decrease_key_count = 0;
+        int size = 0;
+
+        Lazy_Binomial_Heap(){
+            min = nullptr;
+        }
+
+        ~Lazy_Binomial_Heap(){
+            clear();
+        }
+
+        Lazy_Binomial_Heap(const Lazy_Binomial_Heap&) = delete;
+        Lazy_Binomial_Heap& operator=(const Lazy_Binomial_Heap&) = delete;
+
+        Lazy_Binomial_Item* insert(int key, int vertexId){
+            insert_count++;
+            size++;
+
+            Lazy_Binomial_Item* item = new Lazy_Binomial_Item(vertexId);
+            Lazy_Binomial_Heap_Node* node = new Lazy_Binomial_Heap_Node(key, item);
+            addRoot(node);
+            return item;
+        }
+
+        // Splices other's root list into ours; other is left empty
+        void merge(Lazy_Binomial_Heap* other){
+            if (!other || !other->min) return;
+            if (!min){
+                min = other->min;
+            }
+            else{
+                Lazy_Binomial_Heap_Node* a = min->right;
+                Lazy_Binomial_Heap_Node* b = other->min->left;
+                min->right = other->min;
+                other->min->left = min;
+                a->left = b;
+                b->right = a;
+                if (other->min->key < min->key) min = other->min;
+            }
+            size += other->size;
+            other->min = nullptr;
+            other->size = 0;
+        }
+
+        int min_key(){
+            return min ? min->key : INT_MAX;
+        }
+
+        void decrease_key(Lazy_Binomial_Item* item, int newKey){
+            HeapOpTimer timer(decrease_key_time);
+
+            Lazy_Binomial_Heap_Node* node = item->node;
+            if (newKey < node->key){
+                node->key = newKey;
+
+                // Sift up by swapping payloads; items follow their payload
+                while (node->parent && node->key < node->parent->key){
+                    Lazy_Binomial_Heap_Node* parent = node->parent;
+                    std::swap(node->key, parent->key);
+                    std::swap(node->item, parent->item);
+                    node->item->node = node;
+                    parent->item->node = parent;
+                    node = parent;
+                }
+
+                if (!node->parent && node->key < min->key){
+                    min = node;
+                }
+            }
+
+            decrease_key_count++;
+        }
+
+        // Removes the minimum and returns its vertex id (-1 if empty)
+        int extract_min(){
+            HeapOpTimer timer(extract_min_time);
+
+            int vertexId = -1;
+            if (min){
+                Lazy_Binomial_Heap_Node* old = min;
+                vertexId = old->item->vertexId;
+
+                // Collect remaining roots and the children of the old min
+                roots.clear();
+                for (Lazy_Binomial_Heap_Node* r = old->right; r != old; r = r->right){
+                    roots.push_back(r);
+                }
+                for (Lazy_Binomial_Heap_Node* c = old->firstChild; c; c = c->sibling){
+                    roots.push_back(c);
+                }
+
+                delete old->item;
+                delete old;
+                size--;
+
+                consolidate();
+            }
+
+            extract_min_count++;
+
+            return vertexId;
+        }
+
+        bool empty(){
+            return min == nullptr;
+        }
+
+        // Frees every node and item still in the heap
+        void clear(){
+            if (!min) return;
+            HeapScratchVector<Lazy_Binomial_Heap_Node*> stack;
+            Lazy_Binomial_Heap_Node* r = min;
+            do {
+                stack.push_back(r);
+                r = r->right;
+            } while (r != min);
+
+            while (!stack.empty()){
+                Lazy_Binomial_Heap_Node* n = stack.back();
+                stack.pop_back();
+                for (Lazy_Binomial_Heap_Node* c = n->firstChild; c; c = c->sibling){
+                    stack.push_back(c);
+                }
+                delete n->item;
+                delete n;
+            }
+            min = nullptr;
+            size = 0;
+        }
+
+        // Print performance statistics
+        void print_stats() {
+            std::cout << "\n=== Lazy Binomial Heap Statistics ===\n";
+            std::cout << "Number of operations:\n";
+            std::cout << "  Insert:       " << insert_count << "\n";
+            std::cout << "  Extract-min:  " << extract_min_count << "\n";
+            std::cout << "  Decrease-key: " << decrease_key_count << "\n";
+            std::cout << "\nTime spent:\n";
+            std::cout << "  Extract-min:  " << extract_min_time / 1000.0 << " μs\n";
+            std::cout << "  Decrease-key: " << decrease_key_time / 1000.0 << " μs\n";
+            std::cout << "=====================================\n";
+        }
+
+    private:
+        void addRoot(Lazy_Binomial_Heap_Node* node){
+            node->parent = nullptr;
+            node->sibling = nullptr;
+            if (!min){
+                node->left = node;
+                node->right = node;
+                min = node;
+                return;
+            }
+            node->right = min->right;
+            node->left = min;
+            min->right->left = node;
+            min->right = node;
+            if (node->key < min->key) min = node;
+        }
+
+        // Smaller key becomes the parent; returns the new root
+        Lazy_Binomial_Heap_Node* link(Lazy_Binomial_Heap_Node* a, Lazy_Binomial_Heap_Node* b){
+            if (b->key < a->key) std::swap(a, b);
+            b->parent = a;
+            b->sibling = a->firstChild;
+            a->firstChild = b;
+            a->degree++;
+            return a;
+        }
+
+        // Links roots of equal degree until all degrees differ, then rebuilds
+        // the root list from the table and finds the new min
+        void consolidate(){
+            min = nullptr;
+            for (Lazy_Binomial_Heap_Node* r : roots){
+                r->parent = nullptr;
+                while (true){
+                    if ((int)byDegree.size() <= r->degree) byDegree.resize(r->degree + 1, nullptr);
+                    Lazy_Binomial_Heap_Node* other = byDegree[r->degree];
+                    if (!other) break;
+                    byDegree[r->degree] = nullptr;
+                    r = link(r, other);
+                }
+                byDegree[r->degree] = r;
+            }
+
+            for (Lazy_Binomial_Heap_Node*& r : byDegree){
+                if (r){
+                    addRoot(r);
+                    r = nullptr;
+                }
+            }
+        }
+};
+
+#endif // LAZY_BINOMIAL_HEAP_HPP
@@ -11,34 +11,25 @@
 #include <bits/stdc++.h>
 #include "binomial_heap.hpp"
 #include "pairingHeap.hpp"
+#include "Lazy_Binomial_Heap.hpp"
+#include "Hollow_Heap.hpp"
+#include "graphQueries.hpp"
+#include "graphGenerator.hpp"
+#include "heapTrace.hpp"
+#include "compressedGraph.hpp"
 
-using namespace std;
-
-/* =======================
-   GRAPH IMPLEMENTATION
-   ======================= */
-
-struct Graph {
-    int V;
-    vector<vector<pair<int,int>>> adj;
-
-    Graph(int vertices) : V(vertices), adj(vertices) {}
-
-    void addEdge(int u, int v, int w) {
-        adj[u].push_back({v, w});
-        adj[v].push_back({u, w});
-    }
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
 
-    const vector<pair<int,int>>& neighbors(int u) const {
-        return adj[u];
-    }
-};
+using namespace std;
 
 /* =======================
    PRIM'S ALGORITHM
    ======================= */
 
-void primMST_Pairing(const Graph& graph, int start, PairingHeap& pq) {
+void primMST_Pairing(const Graph& graph, int start, PairingHeap& pq,
+                     HeapTraceWriter* trace = nullptr) {
     int V = graph.V;
 
     vector<int> key(V, INT_MAX);
@@ -50,6 +41,7 @@ void primMST_Pairing(const Graph& graph, int start, PairingHeap& pq) {
 
     //Uncomment this to use for PAIRING HEAP
     vector<HeapNode*> heap_nodes(V);
+    vector<pair<HeapNode*, int>> batch;
 
     //Uncoomment this to use for BINOMIAL HEAP
     //vector<Binomial_Heap_Node*> heap_nodes(V);
@@ -59,12 +51,14 @@ void primMST_Pairing(const Graph& graph, int start, PairingHeap& pq) {
 
     for (int v = 0; v < V; v++) {
         heap_nodes[v] = pq.insert(key[v], v);
+        if (trace) trace->record_insert(heap_nodes[v], key[v], v);
     }
 
     while (!pq.empty()) {
         HeapNode* min_node = pq.extract_min();
         int u = min_node->value;
         int min_key = min_node->key;
+        if (trace) trace->record_extract(min_node);
         delete min_node;
 
         /*
@@ -81,13 +75,17 @@ void primMST_Pairing(const Graph& graph, int start, PairingHeap& pq) {
         inHeap[u] = false;
         
 
+        // All improvements from u go to the heap as one batch
+        batch.clear();
         for (auto [v, weight] : graph.neighbors(u)) {
             if (inHeap[v] && weight < key[v]) {
                 key[v] = weight;
                 parent[v] = u;
-                pq.decrease_key(heap_nodes[v], weight);
+                batch.push_back({heap_nodes[v], weight});
+                if (trace) trace->record_decrease(heap_nodes[v], weight);
             }
         }
+        if (!batch.empty()) pq.decrease_keys(batch);
     }
 
     /*
@@ -104,7 +102,8 @@ void primMST_Pairing(const Graph& graph, int start, PairingHeap& pq) {
     */
 }
 
-void primMST_Binomial(const Graph& graph, int start, Binomial_Heap& pq) {
+void primMST_Binomial(const Graph& graph, int start, Binomial_Heap& pq,
+                      HeapTraceWriter* trace = nullptr) {
     int V = graph.V;
 
     vector<int> key(V, INT_MAX);
@@ -125,9 +124,11 @@ void primMST_Binomial(const Graph& graph, int start, Binomial_Heap& pq) {
 
     for (int v = 0; v < V; v++) {
         heap_nodes[v] = pq.insert(key[v], v);
+        if (trace) trace->record_insert(heap_nodes[v], key[v], v);
     }
 
     while (!pq.empty()) {
+        if (trace) trace->record_extract(pq.find_min());
         int min_key = pq.extract_min();
 
         // Workaround: find which vertex has this key and is still in heap
@@ -147,6 +148,7 @@ void primMST_Binomial(const Graph& graph, int start, Binomial_Heap& pq) {
                 key[v] = weight;
                 parent[v] = u;
                 pq.decrease_key(heap_nodes[v], weight);
+                if (trace) trace->record_decrease(heap_nodes[v], weight);
             }
         }
     }
@@ -166,24 +168,265 @@ void primMST_Binomial(const Graph& graph, int start, Binomial_Heap& pq) {
     
 }
 
-Graph generateGraph(int V, int E) {
-    Graph g(V);
-    srand(0); 
-    cout << "Number of vertices: " << V << endl;
-    cout << "Number of edges: " << E << endl;
-    for (int i = 0; i < E; i++) {
-        int u = rand() % V; //random vertex between 0 and V-1
-        int v = rand() % V; //random veertex between 0 and V-1
-        int w = rand() % 100 + 1; //random edge weight between 1-100
+// Lazy_Binomial_Heap hands back the vertex id, so no key-to-vertex scan.
+// Returns total weight.
+long long primMST_LazyBinomial(const Graph& graph, int start, Lazy_Binomial_Heap& pq,
+                         HeapTraceWriter* trace = nullptr) {
+    int V = graph.V;
+
+    vector<int> key(V, INT_MAX);
+    vector<int> parent(V, -1);
+    vector<bool> inHeap(V, true);
+    vector<Lazy_Binomial_Item*> heap_nodes(V);
+
+    key[start] = 0;
+
+    for (int v = 0; v < V; v++) {
+        heap_nodes[v] = pq.insert(key[v], v);
+        if (trace) trace->record_insert(heap_nodes[v], key[v], v);
+    }
+
+    while (!pq.empty()) {
+        int u = pq.extract_min();
+        if (trace) trace->record_extract(heap_nodes[u]);
+        inHeap[u] = false;
+
+        for (auto [v, weight] : graph.neighbors(u)) {
+            if (inHeap[v] && weight < key[v]) {
+                key[v] = weight;
+                parent[v] = u;
+                pq.decrease_key(heap_nodes[v], weight);
+                if (trace) trace->record_decrease(heap_nodes[v], weight);
+            }
+        }
+    }
+
+    long long total = 0;
+    for (int v = 0; v < V; v++) {
+        if (parent[v] != -1) total += key[v];
+    }
+    return total;
+}
+
+// Hollow_Heap: decrease_key never cuts, it links a new node with the root.
+// Returns total weight.
+long long primMST_Hollow(const Graph& graph, int start, Hollow_Heap& pq,
+                   HeapTraceWriter* trace = nullptr) {
+    int V = graph.V;
+
+    vector<int> key(V, INT_MAX);
+    vector<int> parent(V, -1);
+    vector<bool> inHeap(V, true);
+    vector<Hollow_Heap_Item*> heap_nodes(V);
+
+    key[start] = 0;
+
+    for (int v = 0; v < V; v++) {
+        heap_nodes[v] = pq.insert(key[v], v);
+        if (trace) trace->record_insert(heap_nodes[v], key[v], v);
+    }
+
+    while (!pq.empty()) {
+        int u = pq.extract_min();
+        if (trace) trace->record_extract(heap_nodes[u]);
+        inHeap[u] = false;
+
+        for (auto [v, weight] : graph.neighbors(u)) {
+            if (inHeap[v] && weight < key[v]) {
+                key[v] = weight;
+                parent[v] = u;
+                pq.decrease_key(heap_nodes[v], weight);
+                if (trace) trace->record_decrease(heap_nodes[v], weight);
+            }
+        }
+    }
+
+    long long total = 0;
+    for (int v = 0; v < V; v++) {
+        if (parent[v] != -1) total += key[v];
+    }
+    return total;
+}
+
+/* =======================
+   DENSE-GRAPH PRIM
+   ======================= */
+
+// Graphs with more than this fraction of all V(V-1)/2 possible edges use the
+// O(V^2) array version instead of a heap (decrease_key dominates there).
+const double DENSE_PRIM_DENSITY = 0.25;
+const long long DENSE_PRIM_MAX_MATRIX_BYTES = 1LL << 30;
+
+// Contiguous row-major V x V weight matrix, INT_MAX where there is no edge
+struct DenseGraph {
+    int V;
+    GraphVector<int> w;
+
+    DenseGraph(int vertices) : V(vertices), w((long long)vertices * vertices, INT_MAX) {}
+
+    const int* row(int u) const { return &w[(long long)u * V]; }
+};
+
+// Parallel edges keep the lightest
+DenseGraph buildDenseGraph(const Graph& graph) {
+    DenseGraph d(graph.V);
+    for (int u = 0; u < graph.V; u++) {
+        int* row = &d.w[(long long)u * graph.V];
+        for (auto [v, weight] : graph.neighbors(u)) {
+            if (weight < row[v]) row[v] = weight;
+        }
+    }
+    return d;
+}
+
+// The AVX2 loops are compiled with a target attribute and picked at run
+// time, so the default build (no -mavx2) still has them; other compilers
+// and architectures get the scalar loops only.
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define DENSE_PRIM_AVX2 1
+#define DENSE_PRIM_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define DENSE_PRIM_AVX2 0
+#endif
+
+bool densePrimUseAvx2() {
+#if DENSE_PRIM_AVX2
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+#else
+    return false;
+#endif
+}
+
+// Index of the first minimum of key[0..n)
+int argminKeyScalar(const int* key, int n) {
+    int best = 0;
+    for (int j = 1; j < n; j++) {
+        if (key[j] < key[best]) best = j;
+    }
+    return best;
+}
+
+// Lowers k[v] to u's edge weight where that is better, for non-tree v
+void relaxRowScalar(const int* row, const int* mask, int* k, int* p, int u, int V) {
+    for (int v = 0; v < V; v++) {
+        int cand = row[v] | mask[v];
+        bool better = cand < k[v];
+        k[v] = better ? cand : k[v];
+        p[v] = better ? u : p[v];
+    }
+}
+
+#if DENSE_PRIM_AVX2
+DENSE_PRIM_TARGET_AVX2
+int argminKeyAvx2(const int* key, int n) {
+    int i = 0;
+    __m256i vmin = _mm256_set1_epi32(INT_MAX);
+    for (; i + 8 <= n; i += 8) {
+        vmin = _mm256_min_epi32(vmin, _mm256_loadu_si256((const __m256i*)(key + i)));
+    }
+    __m128i m = _mm_min_epi32(_mm256_castsi256_si128(vmin), _mm256_extracti128_si256(vmin, 1));
+    m = _mm_min_epi32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(1, 0, 3, 2)));
+    m = _mm_min_epi32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(2, 3, 0, 1)));
+    int best = _mm_cvtsi128_si32(m);
+    for (int j = i; j < n; j++) {
+        if (key[j] < best) best = key[j];
+    }
+
+    // Second pass: first position holding the minimum
+    int j = 0;
+    __m256i target = _mm256_set1_epi32(best);
+    for (; j + 8 <= n; j += 8) {
+        __m256i eq = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(key + j)), target);
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(eq));
+        if (mask) return j + __builtin_ctz(mask);
+    }
+    for (; j < n; j++) {
+        if (key[j] == best) return j;
+    }
+    return 0;
+}
+
+DENSE_PRIM_TARGET_AVX2
+void relaxRowAvx2(const int* row, const int* mask, int* k, int* p, int u, int V) {
+    int v = 0;
+    __m256i vu = _mm256_set1_epi32(u);
+    for (; v + 8 <= V; v += 8) {
+        __m256i cand = _mm256_or_si256(_mm256_loadu_si256((const __m256i*)(row + v)),
+                                       _mm256_loadu_si256((const __m256i*)(mask + v)));
+        __m256i kv = _mm256_loadu_si256((const __m256i*)(k + v));
+        __m256i better = _mm256_cmpgt_epi32(kv, cand);
+        _mm256_storeu_si256((__m256i*)(k + v), _mm256_min_epi32(kv, cand));
+        __m256i pv = _mm256_loadu_si256((const __m256i*)(p + v));
+        _mm256_storeu_si256((__m256i*)(p + v), _mm256_blendv_epi8(pv, vu, better));
+    }
+    relaxRowScalar(row + v, mask + v, k + v, p + v, u, V - v);
+}
+#endif
+
+// Array-based Prim: argmin over the key array, then one branchless pass over
+// u's matrix row. Tree vertices carry an all-ones mask so row | mask becomes
+// INT_MAX and never lowers their key. Spans start's component and returns
+// its total weight, like mstWeight.
+long long primMST_Dense(const DenseGraph& graph, int start) {
+    int V = graph.V;
+    bool avx2 = densePrimUseAvx2();
+
+    ScratchVector<int> key(V, INT_MAX);
+    ScratchVector<int> parent(V, -1);
+    ScratchVector<int> treeMask(V, 0);  // INT_MAX once in the tree
+    key[start] = 0;
 
-        if (u != v) {
-            g.addEdge(u, v, w);
+    long long total = 0;
+    for (int added = 0; added < V; added++) {
+#if DENSE_PRIM_AVX2
+        int u = avx2 ? argminKeyAvx2(key.data(), V) : argminKeyScalar(key.data(), V);
+#else
+        int u = argminKeyScalar(key.data(), V);
+#endif
+        if (key[u] == INT_MAX) break; // rest is unreachable from start
+        total += key[u];
+        treeMask[u] = INT_MAX;
+        key[u] = INT_MAX;
+
+#if DENSE_PRIM_AVX2
+        if (avx2) {
+            relaxRowAvx2(graph.row(u), treeMask.data(), key.data(), parent.data(), u, V);
+            continue;
         }
+#endif
+        relaxRowScalar(graph.row(u), treeMask.data(), key.data(), parent.data(), u, V);
     }
-    return g;
+    return total;
 }
 
-int main() {
+// Picks the dense array version or the heap version by edge density.
+// The matrix is built here; callers running many MSTs on one dense graph
+// should build a DenseGraph once and call primMST_Dense directly.
+long long primMST_Auto(const Graph& graph, int start) {
+    long long V = graph.V;
+    double density = V > 1 ? graph.edgeCount() / (V * (V - 1) / 2.0) : 0.0;
+    bool fits = V * V * (long long)sizeof(int) <= DENSE_PRIM_MAX_MATRIX_BYTES;
+
+    if (density > DENSE_PRIM_DENSITY && fits) {
+        return primMST_Dense(buildDenseGraph(graph), start);
+    }
+    QueryContext ctx(graph.V);
+    return mstWeight(graph, start, ctx);
+}
+
+Graph generateGraph(int V, int E) {
+    GenOptions opt;
+    opt.seed = 0; // weights default to 1-100
+    cout << "Number of vertices: " << V << endl;
+    cout << "Number of edges: " << E << endl;
+    return toGraph(V, generateGnm(V, E, opt));
+}
+
+// Usage: PrimsHeapImplementation [trace_prefix]
+// With a prefix, heap operations are recorded to <prefix>_prim_binomial.htrc
+// and <prefix>_prim_pairing.htrc (workspace runs) for heapReplay.
+int main(int argc, char** argv) {
     /*
     Graph g(5);
     g.addEdge(0, 1, 2);
@@ -199,6 +442,15 @@ int main() {
     int V = 10000;
     int E = 50000;
     Graph g = generateGraph(V, E);
+
+    string trace_prefix = argc > 1 ? argv[1] : "";
+    unique_ptr<HeapTraceWriter> binomial_trace, pairing_trace, hollow_trace;
+    if (!trace_prefix.empty()) {
+        binomial_trace = make_unique<HeapTraceWriter>(trace_prefix + "_prim_binomial.htrc");
+        pairing_trace = make_unique<HeapTraceWriter>(trace_prefix + "_prim_pairing.htrc");
+        hollow_trace = make_unique<HeapTraceWriter>(trace_prefix + "_prim_hollow.htrc");
+    }
+
     //uncomment the necessary comments to test pairing
     //PairingHeap pairing_pq; 
 
@@ -208,10 +460,84 @@ int main() {
     auto start = chrono::high_resolution_clock::now();
 
     //primMST_Pairing(g, 0, pairing_pq);      //uncomment for pairing 
-    primMST_Binomial(g, 0, binomial_pq);  //uncomment for binomial 
+    primMST_Binomial(g, 0, binomial_pq, binomial_trace.get());  //uncomment for binomial 
     //pairing_pq.print_stats();               //uncomment for pairing 
     binomial_pq.print_stats();            //uncomment for binomial 
     auto end = chrono::high_resolution_clock::now();
     cout << "Total time: " << chrono::duration_cast<chrono::microseconds>(end - start).count() << " μs\n";
+
+    Lazy_Binomial_Heap lazy_pq;
+    auto lazy_start = chrono::high_resolution_clock::now();
+    long long lazy_total = primMST_LazyBinomial(g, 0, lazy_pq);
+    auto lazy_end = chrono::high_resolution_clock::now();
+    cout << "Total weight (lazy binomial): " << lazy_total << endl;
+    lazy_pq.print_stats();
+    cout << "Total time: " << chrono::duration_cast<chrono::microseconds>(lazy_end - lazy_start).count() << " μs\n";
+
+    Hollow_Heap hollow_pq;
+    auto hollow_start = chrono::high_resolution_clock::now();
+    long long hollow_total = primMST_Hollow(g, 0, hollow_pq, hollow_trace.get());
+    auto hollow_end = chrono::high_resolution_clock::now();
+    cout << "Total weight (hollow): " << hollow_total << endl;
+    hollow_pq.print_stats();
+    cout << "Total time: " << chrono::duration_cast<chrono::microseconds>(hollow_end - hollow_start).count() << " μs\n";
+
+    // Dense mode: near-complete graph (90% of all pairs), array Prim vs heap Prim
+    int denseV = 2000;
+    long long densePairs = (long long)denseV * (denseV - 1) / 2;
+    GenOptions dense_opt;
+    dense_opt.dedup = true;
+    dense_opt.maxWeight = 1000000;
+    Graph dense = toGraph(denseV, generateGnm(denseV, densePairs * 9 / 10, dense_opt));
+    cout << "\nDense graph: " << denseV << " vertices, " << dense.edgeCount() << " edges (density "
+         << fixed << setprecision(2) << dense.edgeCount() / (double)densePairs << defaultfloat << ")\n";
+
+    QueryContext dense_ctx(denseV);
+    auto heap_start = chrono::high_resolution_clock::now();
+    long long heap_total = mstWeight(dense, 0, dense_ctx);
+    auto heap_end = chrono::high_resolution_clock::now();
+    DenseGraph matrix = buildDenseGraph(dense);
+    auto build_end = chrono::high_resolution_clock::now();
+    long long dense_total = primMST_Dense(matrix, 0);
+    auto dense_end = chrono::high_resolution_clock::now();
+    long long auto_total = primMST_Auto(dense, 0);
+    Hollow_Heap dense_hollow_pq;
+    auto dense_hollow_start = chrono::high_resolution_clock::now();
+    long long dense_hollow_total = primMST_Hollow(dense, 0, dense_hollow_pq);
+    auto dense_hollow_end = chrono::high_resolution_clock::now();
+    cout << "Total weight (pairing heap): " << heap_total << " in "
+         << chrono::duration_cast<chrono::microseconds>(heap_end - heap_start).count() << " μs\n";
+    cout << "Total weight (dense array): " << dense_total << " in "
+         << chrono::duration_cast<chrono::microseconds>(dense_end - build_end).count() << " μs (matrix build "
+         << chrono::duration_cast<chrono::microseconds>(build_end - heap_end).count() << " μs)\n";
+    cout << "Total weight (hollow heap): " << dense_hollow_total << " in "
+         << chrono::duration_cast<chrono::microseconds>(dense_hollow_end - dense_hollow_start).count() << " μs ("
+         << dense_hollow_pq.decrease_key_count << " decrease-keys)\n";
+    cout << "Total weight (auto): " << auto_total << "\n";
+
+    // Repeated runs share one workspace: no O(V) re-initialization per run
+    QueryContext ctx(V);
+    auto ws_start = chrono::high_resolution_clock::now();
+    long long ws_total = 0;
+    for (int run = 0; run < 10; run++) {
+        ws_total = mstWeight(g, run, ctx, nullptr, run == 0 ? pairing_trace.get() : nullptr);
+    }
+    auto ws_end = chrono::high_resolution_clock::now();
+    cout << "Total weight (pairing, reused workspace): " << ws_total << endl;
+    cout << "10 runs with reused workspace: " << chrono::duration_cast<chrono::microseconds>(ws_end - ws_start).count() << " μs\n";
+
+    // Same runs on delta + varint encoded adjacency
+    CompressedGraph cg(g);
+    auto cg_start = chrono::high_resolution_clock::now();
+    long long cg_total = 0;
+    for (int run = 0; run < 10; run++) {
+        cg_total = mstWeight(cg, run, ctx);
+    }
+    auto cg_end = chrono::high_resolution_clock::now();
+    size_t plain_bytes = g.adj.size() * sizeof(AdjList) + 2 * g.edgeCount() * sizeof(pair<int,int>);
+    cout << "Total weight (pairing, compressed graph): " << cg_total
+         << (cg_total == ws_total ? "" : " MISMATCH") << endl;
+    cout << "10 runs on compressed graph: " << chrono::duration_cast<chrono::microseconds>(cg_end - cg_start).count()
+         << " μs (" << plain_bytes / 1024 << " KB -> " << cg.bytes() / 1024 << " KB)\n";
     return 0;
 }
@@ -0,0 +1,176 @@
+/*
+ * COMPRESSED GRAPH
+ *
+ * Read-only adjacency storage with neighbor lists sorted by vertex id and
+ * each (neighbor, weight) entry packed into one byte-aligned varint
+ * (LEB128: 7 payload bits per byte, high bit = more bytes follow):
+ *
+ *   value = gap << weightBits | weight
+ *   gap   = zigzag(v - u) for the first neighbor of u, v - previous after it
+ *
+ * weightBits is the width of the largest weight, so weights 1-100 take 7
+ * bits, and gaps stay small on reordered or local graphs. A G(n,m) entry
+ * takes about 3-4 bytes instead of the 8 of a pair<int,int>. Parallel edges
+ * are merged, keeping the lightest, which shortest-path and MST results do
+ * not depend on. Weights must be non-negative.
+ *
+ * neighbors(u) decodes on the fly and yields pair<int,int> by value, so
+ * loops written for Graph work unchanged:
+ *     for (auto [v, w] : cg.neighbors(u)) ...
+ *
+ * PUBLIC INTERFACE:
+ * ------------------------------------------------
+ * CompressedGraph cg(g);                 // from an adjacency-list Graph
+ * cg.V, cg.neighbors(u), cg.degree(u), cg.edgeCount()
+ * cg.bytes()                             // offsets + encoded lists
+ */
+
+#ifndef COMPRESSED_GRAPH_HPP
+#define COMPRESSED_GRAPH_HPP
+
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include "graph.hpp"
+#include "memoryTracker.hpp"
+
+class CompressedGraph {
+    public:
+        class Iterator {
+            public:
+                typedef std::forward_iterator_tag iterator_category;
+                typedef std::pair<int,int> value_type;
+                typedef std::ptrdiff_t difference_type;
+                typedef const value_type* pointer;
+                typedef value_type reference;
+
+                Iterator(const uint8_t* at, const uint8_t* end, int u, int weightBits)
+                    : at(at), end(end), weightBits(weightBits), current(u, 0) {
+                    if (at != end) decode(true);
+                }
+
+                std::pair<int,int> operator*() const { return current; }
+
+                Iterator& operator++() {
+                    at = next;
+                    if (at != end) decode(false);
+                    return *this;
+                }
+
+                bool operator==(const Iterator& o) const { return at == o.at; }
+                bool operator!=(const Iterator& o) const { return at != o.at; }
+
+            private:
+                const uint8_t* at;   // start of the current entry
+                const uint8_t* next; // start of the following entry
+                const uint8_t* end;
+                int weightBits;
+                std::pair<int,int> current;
+
+                // current.first holds u before the first entry, the previous
+                // neighbor after it
+                void decode(bool first) {
+                    const uint8_t* p = at;
+                    uint64_t value = *p & 0x7f;
+                    for (int shift = 7; *p++ & 0x80; shift += 7) value |= (uint64_t)(*p & 0x7f) << shift;
+                    next = p;
+
+                    uint64_t gap = value >> weightBits;
+                    current.second = (int)(value & ((1ULL << weightBits) - 1));
+                    if (first) current.first += (int)(gap >> 1) ^ -(int)(gap & 1);
+                    else current.first += (int)gap;
+                }
+        };
+
+        class Range {
+            public:
+                Range(const uint8_t* first, const uint8_t* last, int u, int weightBits)
+                    : first(first), last(last), u(u), weightBits(weightBits) {}
+
+                Iterator begin() const { return Iterator(first, last, u, weightBits); }
+                Iterator end() const { return Iterator(last, last, u, weightBits); }
+                bool empty() const { return first == last; }
+
+            private:
+                const uint8_t* first;
+                const uint8_t* last;
+                int u;
+                int weightBits;
+        };
+
+        int V;
+
+        explicit CompressedGraph(const Graph& g) : V(g.V), offsets(g.V + 1), degrees(g.V) {
+            int maxWeight = 0;
+            for (int u = 0; u < V; u++) {
+                for (auto [v, w] : g.neighbors(u)) {
+                    if (w < 0) throw std::runtime_error("CompressedGraph: negative edge weight");
+                    maxWeight = std::max(maxWeight, w);
+                }
+            }
+            weightBits = 0;
+            while (weightBits < 31 && (maxWeight >> weightBits) != 0) weightBits++;
+
+            ScratchVector<std::pair<int,int>> list;
+            for (int u = 0; u < V; u++) {
+                offsets[u] = encoded.size();
+                const AdjList& adj = g.neighbors(u);
+                list.assign(adj.begin(), adj.end());
+                std::sort(list.begin(), list.end());
+                list.erase(std::unique(list.begin(), list.end(),
+                                       [](const std::pair<int,int>& a, const std::pair<int,int>& b) {
+                                           return a.first == b.first;
+                                       }),
+                           list.end());
+
+                int prev = u;
+                for (size_t i = 0; i < list.size(); i++) {
+                    auto [v, w] = list[i];
+                    int64_t delta = (int64_t)v - prev;
+                    uint64_t gap = i == 0 ? ((uint64_t)delta << 1) ^ (uint64_t)(delta >> 63) : (uint64_t)delta;
+                    put((gap << weightBits) | (uint64_t)w);
+                    prev = v;
+                }
+                degrees[u] = (int)list.size();
+                entries += list.size();
+            }
+            offsets[V] = encoded.size();
+            encoded.shrink_to_fit();
+        }
+
+        Range neighbors(int u) const {
+            return Range(encoded.data() + offsets[u], encoded.data() + offsets[u + 1], u, weightBits);
+        }
+
+        int degree(int u) const {
+            return degrees[u];
+        }
+
+        long long edgeCount() const {
+            return entries / 2;
+        }
+
+        size_t bytes() const {
+            return offsets.size() * sizeof(uint64_t) + degrees.size() * sizeof(int) + encoded.size();
+        }
+
+    private:
+        GraphVector<uint64_t> offsets;  // byte offset of each list in encoded
+        GraphVector<int> degrees;
+        GraphVector<uint8_t> encoded;
+        int weightBits;
+        long long entries = 0;
+
+        void put(uint64_t value) {
+            while (value >= 0x80) {
+                encoded.push_back((uint8_t)(value | 0x80));
+                value >>= 7;
+            }
+            encoded.push_back((uint8_t)value);
+        }
+};
+
+#endif // COMPRESSED_GRAPH_HPP
@@ -1,164 +1,165 @@
 #include <bits/stdc++.h>
 #include "binomial_heap.hpp"
+#include "Lazy_Binomial_Heap.hpp"
+#include "Hollow_Heap.hpp"
+#include "pairingHeap.hpp"
+#include "graphQueries.hpp"
+#include "graphGenerator.hpp"
+#include "graphReorder.hpp"
+#include "perfCounters.hpp"
+#include "heapTrace.hpp"
+#include "externalDijkstra.hpp"
+#include "compressedGraph.hpp"
 using namespace std;
 
 /* =======================
-   PAIRING HEAP
+   DIJKSTRA - PAIRING
    ======================= */
 
-struct HeapNode {
-    int key, value;
-    HeapNode *parent, *child, *sibling;
-
-    HeapNode(int k, int v)
-        : key(k), value(v), parent(nullptr), child(nullptr), sibling(nullptr) {}
+void dijkstra_pairing(const Graph& g, int src, QueryStats& stats,
+                      HeapTraceWriter* trace = nullptr) {
 
-    void addChild(HeapNode *node) {
-        node->parent = this;
-        node->sibling = child;
-        child = node;
-    }
-};
+    const int INF = INT_MAX;
+    int V = g.V;
 
-struct PairingHeap {
-    HeapNode *root;
-    PairingHeap() : root(nullptr) {}
+    ScratchVector<int> dist(V, INF);
+    ScratchVector<bool> done(V, false);
+    ScratchVector<HeapNode*> nodes(V);
+    ScratchVector<pair<HeapNode*, int>> batch;
 
-    HeapNode* insert(int key, int value) {
-        HeapNode* node = new HeapNode(key, value);
-        root = merge(root, node);
-        return node;
-    }
+    PairingHeap pq;
+    dist[src] = 0;
 
-    int extract_min() {
-        if (!root) throw runtime_error("Empty heap");
-        int val = root->value;
-        HeapNode* old = root;
-        root = merge_pairs(root->child);
-        if (root) root->parent = nullptr;
-        delete old;
-        return val;
+    for (int i = 0; i < V; i++) {
+        auto t1 = chrono::high_resolution_clock::now();
+        nodes[i] = pq.insert(dist[i], i);
+        auto t2 = chrono::high_resolution_clock::now();
+        stats.insert_time += chrono::duration_cast<chrono::microseconds>(t2 - t1).count();
+        stats.insert_count++;
+        stats.nodes_allocated++;
+        if (trace) trace->record_insert(nodes[i], dist[i], i);
     }
 
-    void decrease_key(HeapNode* node, int new_key) {
-        if (!node || new_key > node->key) return;
-        node->key = new_key;
-        if (node == root) return;
-        cut(node);
-        root = merge(root, node);
-    }
+    while (!pq.empty()) {
 
-    bool empty() const { return root == nullptr; }
+        auto t1 = chrono::high_resolution_clock::now();
+        HeapNode* min_node = pq.extract_min();
+        auto t2 = chrono::high_resolution_clock::now();
+        int u = min_node->value;
+        if (trace) trace->record_extract(min_node);
+        delete min_node;
 
-private:
-    HeapNode* merge(HeapNode* a, HeapNode* b) {
-        if (!a) return b;
-        if (!b) return a;
-        if (a->key <= b->key) {
-            a->addChild(b);
-            return a;
-        } else {
-            b->addChild(a);
-            return b;
-        }
-    }
+        stats.extract_time += chrono::duration_cast<chrono::microseconds>(t2 - t1).count();
+        stats.extract_count++;
 
-    HeapNode* merge_pairs(HeapNode* first) {
-        if (!first) return nullptr;
-        if (!first->sibling) {
-            first->parent = nullptr;
-            return first;
-        }
+        if (done[u]) continue;
+        done[u] = true;
+        if (dist[u] == INF) continue; // unreachable: dist[u] + w would overflow
 
-        vector<HeapNode*> trees;
-        HeapNode* curr = first;
-
-        while (curr) {
-            HeapNode* a = curr;
-            HeapNode* b = curr->sibling;
-
-            if (b) {
-                HeapNode* next = b->sibling;
-                a->sibling = b->sibling = nullptr;
-                a->parent = b->parent = nullptr;
-                trees.push_back(merge(a, b));
-                curr = next;
-            } else {
-                a->sibling = nullptr;
-                a->parent = nullptr;
-                trees.push_back(a);
-                break;
+        // All improvements from u go to the heap as one batch
+        batch.clear();
+        for (auto [v, w] : g.adj[u]) {
+            if (!done[v] && dist[u] + w < dist[v]) {
+                dist[v] = dist[u] + w;
+                batch.push_back({nodes[v], dist[v]});
+                if (trace) trace->record_decrease(nodes[v], dist[v]);
             }
         }
+        if (batch.empty()) continue;
 
-        HeapNode* result = trees.back();
-        for (int i = trees.size() - 2; i >= 0; --i)
-            result = merge(trees[i], result);
+        auto t3 = chrono::high_resolution_clock::now();
+        pq.decrease_keys(batch);
+        auto t4 = chrono::high_resolution_clock::now();
 
-        return result;
+        stats.decrease_time += chrono::duration_cast<chrono::microseconds>(t4 - t3).count();
+        stats.decrease_count += batch.size();
     }
-
-    void cut(HeapNode* node) {
-        if (!node->parent) return;
-        HeapNode* p = node->parent;
-        if (p->child == node) {
-            p->child = node->sibling;
-        } else {
-            HeapNode* prev = p->child;
-            while (prev && prev->sibling != node)
-                prev = prev->sibling;
-            if (prev) prev->sibling = node->sibling;
-        }
-        node->parent = node->sibling = nullptr;
-    }
-};
+}
 
 /* =======================
-   GRAPH
+   DIJKSTRA - BINOMIAL (SAFE VERSION)
    ======================= */
 
-struct Graph {
-    int V;
-    vector<vector<pair<int,int>>> adj;
+void dijkstra_binomial(const Graph& g, int src, QueryStats& stats,
+                       HeapTraceWriter* trace = nullptr) {
+
+    const int INF = INT_MAX;
+    int V = g.V;
+
+    ScratchVector<int> dist(V, INF);
+    ScratchVector<bool> done(V, false);
+    ScratchVector<Binomial_Heap_Node*> nodes(V);
 
-    Graph(int v) : V(v), adj(v) {}
+    Binomial_Heap pq;
+    dist[src] = 0;
 
-    void addEdge(int u, int v, int w) {
-        adj[u].push_back({v, w});
-        adj[v].push_back({u, w});
+    for (int i = 0; i < V; i++) {
+        auto t1 = chrono::high_resolution_clock::now();
+        nodes[i] = pq.insert(dist[i], i);
+        auto t2 = chrono::high_resolution_clock::now();
+        stats.insert_time += chrono::duration_cast<chrono::microseconds>(t2 - t1).count();
+        stats.insert_count++;
+        stats.nodes_allocated++;
+        if (trace) trace->record_insert(nodes[i], dist[i], i);
     }
-};
 
-/* =======================
-   STATS
-   ======================= */
+    while (!pq.empty()) {
+
+        if (trace) trace->record_extract(pq.find_min());
+        auto t1 = chrono::high_resolution_clock::now();
+        int extracted = pq.extract_min();  // may return KEY not VALUE
+        auto t2 = chrono::high_resolution_clock::now();
+
+        stats.extract_time += chrono::duration_cast<chrono::microseconds>(t2 - t1).count();
+        stats.extract_count++;
+
+        // SAFE mapping: find vertex whose dist matches extracted key
+        int u = -1;
+        for (int i = 0; i < V; i++) {
+            if (!done[i] && dist[i] == extracted) {
+                u = i;
+                break;
+            }
+        }
+
+        if (u == -1) continue;
 
-struct Stats {
-    long long insert_time = 0;
-    long long extract_time = 0;
-    long long decrease_time = 0;
+        done[u] = true;
+        if (dist[u] == INF) continue; // unreachable: dist[u] + w would overflow
+
+        for (auto [v, w] : g.adj[u]) {
+            if (!done[v] && dist[u] + w < dist[v]) {
+                dist[v] = dist[u] + w;
 
-    long long insert_count = 0;
-    long long extract_count = 0;
-    long long decrease_count = 0;
+                auto t3 = chrono::high_resolution_clock::now();
+                pq.decrease_key(nodes[v], dist[v]);
+                auto t4 = chrono::high_resolution_clock::now();
 
-    long long nodes_allocated = 0;
-};
+                stats.decrease_time += chrono::duration_cast<chrono::microseconds>(t4 - t3).count();
+                stats.decrease_count++;
+                if (trace) trace->record_decrease(nodes[v], dist[v]);
+            }
+        }
+    }
+}
 
 /* =======================
-   DIJKSTRA - PAIRING
+   DIJKSTRA - LAZY BINOMIAL
    ======================= */
 
-void dijkstra_pairing(const Graph& g, int src, Stats& stats) {
+// Lazy_Binomial_Heap returns the vertex id and keeps handles valid across
+// decrease_key, so no key-to-vertex scan is needed.
+void dijkstra_lazy_binomial(const Graph& g, int src, QueryStats& stats,
+                            HeapTraceWriter* trace = nullptr) {
 
     const int INF = INT_MAX;
     int V = g.V;
 
-    vector<int> dist(V, INF);
-    vector<bool> done(V, false);
-    vector<HeapNode*> nodes(V);
+    ScratchVector<int> dist(V, INF);
+    ScratchVector<bool> done(V, false);
+    ScratchVector<Lazy_Binomial_Item*> nodes(V);
 
-    PairingHeap pq;
+    Lazy_Binomial_Heap pq;
     dist[src] = 0;
 
     for (int i = 0; i < V; i++) {
@@ -168,6 +169,7 @@ void dijkstra_pairing(const Graph& g, int src, Stats& stats) {
         stats.insert_time += chrono::duration_cast<chrono::microseconds>(t2 - t1).count();
         stats.insert_count++;
         stats.nodes_allocated++;
+        if (trace) trace->record_insert(nodes[i], dist[i], i);
     }
 
     while (!pq.empty()) {
@@ -178,9 +180,10 @@ void dijkstra_pairing(const Graph& g, int src, Stats& stats) {
 
         stats.extract_time += chrono::duration_cast<chrono::microseconds>(t2 - t1).count();
         stats.extract_count++;
+        if (trace) trace->record_extract(nodes[u]);
 
-        if (done[u]) continue;
         done[u] = true;
+        if (dist[u] == INF) continue; // unreachable: dist[u] + w would overflow
 
         for (auto [v, w] : g.adj[u]) {
             if (!done[v] && dist[u] + w < dist[v]) {
@@ -192,25 +195,29 @@ void dijkstra_pairing(const Graph& g, int src, Stats& stats) {
 
                 stats.decrease_time += chrono::duration_cast<chrono::microseconds>(t4 - t3).count();
                 stats.decrease_count++;
+                if (trace) trace->record_decrease(nodes[v], dist[v]);
             }
         }
     }
 }
 
 /* =======================
-   DIJKSTRA - BINOMIAL (SAFE VERSION)
+   DIJKSTRA - HOLLOW
    ======================= */
 
-void dijkstra_binomial(const Graph& g, int src, Stats& stats) {
+// Hollow_Heap::decrease_key is O(1): the vertex moves to a fresh node linked
+// with the root and the old node is left hollow for extract_min to clean up.
+void dijkstra_hollow(const Graph& g, int src, QueryStats& stats,
+                     HeapTraceWriter* trace = nullptr) {
 
     const int INF = INT_MAX;
     int V = g.V;
 
-    vector<int> dist(V, INF);
-    vector<bool> done(V, false);
-    vector<Binomial_Heap_Node*> nodes(V);
+    ScratchVector<int> dist(V, INF);
+    ScratchVector<bool> done(V, false);
+    ScratchVector<Hollow_Heap_Item*> nodes(V);
 
-    Binomial_Heap pq;
+    Hollow_Heap pq;
     dist[src] = 0;
 
     for (int i = 0; i < V; i++) {
@@ -220,29 +227,21 @@ void dijkstra_binomial(const Graph& g, int src, Stats& stats) {
         stats.insert_time += chrono::duration_cast<chrono::microseconds>(t2 - t1).count();
         stats.insert_count++;
         stats.nodes_allocated++;
+        if (trace) trace->record_insert(nodes[i], dist[i], i);
     }
 
     while (!pq.empty()) {
 
         auto t1 = chrono::high_resolution_clock::now();
-        int extracted = pq.extract_min();  // may return KEY not VALUE
+        int u = pq.extract_min();  // returns vertex id
         auto t2 = chrono::high_resolution_clock::now();
 
         stats.extract_time += chrono::duration_cast<chrono::microseconds>(t2 - t1).count();
         stats.extract_count++;
-
-        // SAFE mapping: find vertex whose dist matches extracted key
-        int u = -1;
-        for (int i = 0; i < V; i++) {
-            if (!done[i] && dist[i] == extracted) {
-                u = i;
-                break;
-            }
-        }
-
-        if (u == -1) continue;
+        if (trace) trace->record_extract(nodes[u]);
 
         done[u] = true;
+        if (dist[u] == INF) continue; // unreachable: dist[u] + w would overflow
 
         for (auto [v, w] : g.adj[u]) {
             if (!done[v] && dist[u] + w < dist[v]) {
@@ -254,6 +253,8 @@ void dijkstra_binomial(const Graph& g, int src, Stats& stats) {
 
                 stats.decrease_time += chrono::duration_cast<chrono::microseconds>(t4 - t3).count();
                 stats.decrease_count++;
+                stats.nodes_allocated++; // each decrease allocates a node
+                if (trace) trace->record_decrease(nodes[v], dist[v]);
             }
         }
     }
@@ -263,34 +264,112 @@ void dijkstra_binomial(const Graph& g, int src, Stats& stats) {
    RANDOM GRAPH
    ======================= */
 
+// G(n,m) with weights 1-100, seed 0 (see graphGenerator.hpp for other families)
 Graph generateGraph(int V, int E) {
-    Graph g(V);
-    srand(0);
-    for (int i = 0; i < E; i++) {
-        int u = rand() % V;
-        int v = rand() % V;
-        int w = rand() % 100 + 1;
-        if (u != v) g.addEdge(u, v, w);
+    GenOptions opt;
+    opt.seed = 0;
+    return toGraph(V, generateGnm(V, E, opt));
+}
+
+/* =======================
+   REORDERING BENCHMARK
+   ======================= */
+
+// Runs a full shortestPathTree from src on g renumbered by each
+// ordering and checks the distances (mapped back to original ids) against
+// the unordered run. Each ordering is also run on a CompressedGraph.
+void benchmark_reordering(const Graph& g, int src) {
+    vector<pair<string, Reordering>> orders;
+    orders.push_back({"none", identityOrder(g)});
+    orders.push_back({"bfs", bfsOrder(g, src)});
+    orders.push_back({"rcm", rcmOrder(g)});
+    orders.push_back({"degree", degreeOrder(g)});
+
+    vector<int> reference;
+    PerfCounters pc;
+
+    for (auto& [name, order] : orders) {
+        auto p1 = chrono::high_resolution_clock::now();
+        Graph h = permuteGraph(g, order);
+        auto p2 = chrono::high_resolution_clock::now();
+
+        QueryStats st;
+        QueryContext ctx(h.V);
+        const QueryWorkspace<HeapNode*>& ws = ctx.ws;
+        pc.start();
+        auto s1 = chrono::high_resolution_clock::now();
+        shortestPathTree(h, order.oldToNew[src], ctx, &st);
+        auto e1 = chrono::high_resolution_clock::now();
+        pc.stop();
+
+        vector<int> dist(h.V);
+        for (int v = 0; v < h.V; v++) dist[v] = ws.dist(v);
+        dist = toOriginalOrder(dist, order);
+        if (reference.empty()) reference = dist;
+
+        // Same query on delta + varint lists; gaps shrink as the order
+        // gets more local
+        CompressedGraph ch(h);
+        QueryStats cst;
+        QueryContext cctx(ch.V);
+        const QueryWorkspace<HeapNode*>& cws = cctx.ws;
+        auto s2 = chrono::high_resolution_clock::now();
+        shortestPathTree(ch, order.oldToNew[src], cctx, &cst);
+        auto e2 = chrono::high_resolution_clock::now();
+        bool compressedMatches = true;
+        for (int v = 0; v < h.V; v++) {
+            if (cws.dist(v) != ws.dist(v)) compressedMatches = false;
+        }
+        size_t plainBytes = h.adj.size() * sizeof(AdjList) + 2 * h.edgeCount() * sizeof(pair<int,int>);
+
+        cout << "  " << setw(7) << left << name << right
+             << " reorder " << setw(6) << chrono::duration_cast<chrono::milliseconds>(p2 - p1).count() << " ms"
+             << " | dijkstra " << setw(6) << chrono::duration_cast<chrono::milliseconds>(e1 - s1).count() << " ms";
+        if (pc.available()) {
+            cout << " | cache misses " << pc.cache_misses << " / " << pc.cache_references
+                 << " | L1D misses " << pc.l1d_misses;
+        } else {
+            cout << " | cache counters n/a";
+        }
+        cout << " | compressed " << plainBytes / 1024 << " -> " << ch.bytes() / 1024 << " KB, dijkstra "
+             << chrono::duration_cast<chrono::milliseconds>(e2 - s2).count() << " ms";
+        cout << (dist == reference && compressedMatches ? "" : " | DIST MISMATCH") << "\n";
     }
-    return g;
 }
 
 /* =======================
    MAIN
    ======================= */
 
-int main() {
+// Usage: dijkstraTest [trace_prefix]
+// With a prefix, the heap operations of the two full runs are recorded to
+// <prefix>_dijkstra_{pairing,binomial,lazy_binomial,hollow}.htrc.
+int main(int argc, char** argv) {
 
     int V = 10000;
     int E = 50000;
 
     Graph g = generateGraph(V, E);
 
+    string trace_prefix = argc > 1 ? argv[1] : "";
+    unique_ptr<HeapTraceWriter> pairing_trace, binomial_trace, lazy_trace, hollow_trace;
+    if (!trace_prefix.empty()) {
+        pairing_trace = make_unique<HeapTraceWriter>(trace_prefix + "_dijkstra_pairing.htrc");
+        binomial_trace = make_unique<HeapTraceWriter>(trace_prefix + "_dijkstra_binomial.htrc");
+        lazy_trace = make_unique<HeapTraceWriter>(trace_prefix + "_dijkstra_lazy_binomial.htrc");
+        hollow_trace = make_unique<HeapTraceWriter>(trace_prefix + "_dijkstra_hollow.htrc");
+    }
+
+    cout << "===== MEMORY: Graph =====\n";
+    printMemoryReport();
+    cout << "\n";
+
     // Pairing
     cout << "===== DIJKSTRA: Pairing Heap =====\n";
-    Stats ps;
+    QueryStats ps;
+    memResetPeaks();
     auto s1 = chrono::high_resolution_clock::now();
-    dijkstra_pairing(g, 0, ps);
+    dijkstra_pairing(g, 0, ps, pairing_trace.get());
     auto e1 = chrono::high_resolution_clock::now();
 
     cout << "Total runtime: "
@@ -299,14 +378,16 @@ int main() {
     cout << "Insert: " << ps.insert_count << " ops | " << ps.insert_time << " us\n";
     cout << "Extract: " << ps.extract_count << " ops | " << ps.extract_time << " us\n";
     cout << "Decrease: " << ps.decrease_count << " ops | " << ps.decrease_time << " us\n";
-    cout << "Estimated memory: "
-         << (ps.nodes_allocated * sizeof(HeapNode)) / 1024.0 << " KB\n\n";
+    cout << "Memory (peak during run, current after):\n";
+    printMemoryReport();
+    cout << "\n";
 
     // Binomial
     cout << "===== DIJKSTRA: Binomial Heap =====\n";
-    Stats bs;
+    QueryStats bs;
+    memResetPeaks();
     auto s2 = chrono::high_resolution_clock::now();
-    dijkstra_binomial(g, 0, bs);
+    dijkstra_binomial(g, 0, bs, binomial_trace.get());
     auto e2 = chrono::high_resolution_clock::now();
 
     cout << "Total runtime: "
@@ -315,8 +396,127 @@ int main() {
     cout << "Insert: " << bs.insert_count << " ops | " << bs.insert_time << " us\n";
     cout << "Extract: " << bs.extract_count << " ops | " << bs.extract_time << " us\n";
     cout << "Decrease: " << bs.decrease_count << " ops | " << bs.decrease_time << " us\n";
-    cout << "Estimated memory: "
-         << (bs.nodes_allocated * sizeof(Binomial_Heap_Node)) / 1024.0 << " KB\n";
+    cout << "Memory (peak during run, current after; leftover heap nodes are leaked):\n";
+    printMemoryReport();
+    cout << "\n";
+
+    // Lazy binomial
+    cout << "===== DIJKSTRA: Lazy Binomial Heap =====\n";
+    QueryStats ls;
+    memResetPeaks();
+    auto s5 = chrono::high_resolution_clock::now();
+    dijkstra_lazy_binomial(g, 0, ls, lazy_trace.get());
+    auto e5 = chrono::high_resolution_clock::now();
+
+    cout << "Total runtime: "
+         << chrono::duration_cast<chrono::milliseconds>(e5 - s5).count()
+         << " ms\n";
+    cout << "Insert: " << ls.insert_count << " ops | " << ls.insert_time << " us\n";
+    cout << "Extract: " << ls.extract_count << " ops | " << ls.extract_time << " us\n";
+    cout << "Decrease: " << ls.decrease_count << " ops | " << ls.decrease_time << " us\n";
+    cout << "Memory (peak during run, current after):\n";
+    printMemoryReport();
+    cout << "\n";
+
+    // Hollow
+    cout << "===== DIJKSTRA: Hollow Heap =====\n";
+    QueryStats hs;
+    memResetPeaks();
+    auto s6 = chrono::high_resolution_clock::now();
+    dijkstra_hollow(g, 0, hs, hollow_trace.get());
+    auto e6 = chrono::high_resolution_clock::now();
+
+    cout << "Total runtime: "
+         << chrono::duration_cast<chrono::milliseconds>(e6 - s6).count()
+         << " ms\n";
+    cout << "Insert: " << hs.insert_count << " ops | " << hs.insert_time << " us\n";
+    cout << "Extract: " << hs.extract_count << " ops | " << hs.extract_time << " us\n";
+    cout << "Decrease: " << hs.decrease_count << " ops | " << hs.decrease_time << " us\n";
+    cout << "Memory (peak during run, current after):\n";
+    printMemoryReport();
+    cout << "\n";
+
+    // External memory: same graph from a mapped CSR file, with a small queue
+    // budget so the bucket queue has to spill
+    cout << "===== DIJKSTRA: External Memory =====\n";
+    {
+        string csrPath = "/tmp/dijkstraTest_" + to_string(getpid()) + ".csr";
+        writeCsrFile(csrPath, g);
+        MappedCsrGraph eg(csrPath);
+        MappedArray<int> edist("/tmp", eg.V);
+        ExternalDijkstraOptions eopt;
+        eopt.memory_entries = 4096;
+        ExternalIoStats io;
+
+        auto s7 = chrono::high_resolution_clock::now();
+        externalDijkstra(eg, 0, edist, eopt, io);
+        auto e7 = chrono::high_resolution_clock::now();
+        unlink(csrPath.c_str());
+
+        QueryContext ref(V);
+        shortestPathTree(g, 0, ref);
+        int mismatch = 0;
+        for (int v = 0; v < V; v++) {
+            if (edist[v] != ref.ws.dist(v)) mismatch++;
+        }
+
+        cout << "Total runtime: "
+             << chrono::duration_cast<chrono::milliseconds>(e7 - s7).count()
+             << " ms\n";
+        cout << "Adjacency read: " << io.adjacency_bytes << " bytes | spilled "
+             << io.spill_bytes_written << " bytes in " << io.spill_flushes << " flushes | read back "
+             << io.spill_bytes_read << " bytes | buckets " << io.buckets << "\n";
+        cout << "Distances vs pairing heap: "
+             << (mismatch ? "MISMATCH (" + to_string(mismatch) + " vertices)" : "match") << "\n\n";
+    }
+
+    // Point-to-point queries: fresh O(V) arrays per query vs reused workspace
+    cout << "===== POINT-TO-POINT: Pairing Heap =====\n";
+    const int Q = 200;
+    mt19937 rng(1);
+    vector<pair<int,int>> queries(Q);
+    for (auto& q : queries) q = {(int)(rng() % V), (int)(rng() % V)};
+
+    QueryStats fs;
+    long long fresh_sum = 0;
+    auto s3 = chrono::high_resolution_clock::now();
+    for (auto [s, t] : queries) {
+        QueryContext fresh(V);
+        int d = shortestPath(g, s, t, fresh, &fs);
+        if (d != INT_MAX) fresh_sum += d;
+    }
+    auto e3 = chrono::high_resolution_clock::now();
+
+    QueryStats ws_stats;
+    long long reused_sum = 0;
+    QueryContext ctx(V);
+    auto s4 = chrono::high_resolution_clock::now();
+    for (auto [s, t] : queries) {
+        int d = shortestPath(g, s, t, ctx, &ws_stats);
+        if (d != INT_MAX) reused_sum += d;
+    }
+    auto e4 = chrono::high_resolution_clock::now();
+
+    cout << "Queries: " << Q << " (sum of distances " << reused_sum
+         << (reused_sum == fresh_sum ? ", matches" : ", MISMATCH") << ")\n";
+    cout << "Fresh workspace:  "
+         << chrono::duration_cast<chrono::microseconds>(e3 - s3).count() << " us\n";
+    cout << "Reused workspace: "
+         << chrono::duration_cast<chrono::microseconds>(e4 - s4).count() << " us\n";
+    cout << "Avg vertices touched per query: "
+         << (ws_stats.insert_count / (double)Q) << "\n";
+
+    // Vertex reordering: same queries on renumbered copies of the graph, in
+    // adjacency-list and compressed form
+    cout << "\n===== REORDERING: Pairing Heap =====\n";
+    cout << "G(n,m) graph, " << V << " vertices:\n";
+    benchmark_reordering(g, 0);
+
+    int rggV = 200000;
+    GenOptions rggOpt;
+    Graph rgg = toGraph(rggV, generateGeometric(rggV, sqrt(10.0 / (M_PI * rggV)), rggOpt));
+    cout << "Random geometric graph, " << rggV << " vertices:\n";
+    benchmark_reordering(rgg, 0);
 
     return 0;
 }
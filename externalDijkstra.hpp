@@ -0,0 +1,646 @@
+/*
+ * EXTERNAL-MEMORY DIJKSTRA
+ *
+ * Single-source shortest paths on graphs whose edges do not fit in RAM.
+ *
+ *   - The graph lives in an on-disk CSR file that is memory-mapped, so the
+ *     kernel pages adjacency in and out; nothing O(E) is kept in memory.
+ *   - dist lives in a memory-mapped scratch file (MappedArray) for the same
+ *     reason.
+ *   - The priority queue is bucketed by distance (bucket = dist / width).
+ *     Only the bucket being settled is held as an in-memory heap; pushes into
+ *     later buckets go to a shared buffer, which is sorted and appended to
+ *     per-bucket spill files when full. A bucket's spill file is read back
+ *     front to back when the bucket becomes current, so queue I/O is
+ *     sequential appends and sequential reads. A bucket too large for the
+ *     heap is split into narrower key ranges first, so heap and buffer never
+ *     hold more than memory_entries together. Entries are never updated in
+ *     place: a stale entry (d > dist[v]) is skipped when popped.
+ *
+ * CSR file layout (host byte order):
+ *   CsrFileHeader, uint64 offsets[V + 1], CsrEntry entries[offsets[V]]
+ * Each undirected edge is stored in both endpoints' lists.
+ *
+ * PUBLIC INTERFACE:
+ * ------------------------------------------------
+ * writeCsrFile(path, g);                         // from an in-memory Graph
+ * writeCsrFile(path, n, forEachChunk);           // two streaming passes over
+ *                                                // vector<Edge> chunks
+ * MappedCsrGraph g(path);  g.V, g.neighbors(u)   // for (auto [v, w] : ...)
+ * MappedArray<int> dist(dir, g.V);               // unlinked scratch file
+ * ExternalIoStats io;
+ * externalDijkstra(g, src, dist, ExternalDijkstraOptions(), io);
+ * ProcIo now = readProcIo();                     // device-level bytes
+ */
+
+#ifndef EXTERNAL_DIJKSTRA_HPP
+#define EXTERNAL_DIJKSTRA_HPP
+
+#include <vector>
+#include <map>
+#include <string>
+#include <fstream>
+#include <climits>
+#include <cstring>
+#include <cstdlib>
+#include <cerrno>
+#include <cstdint>
+#include <algorithm>
+#include <stdexcept>
+#include <functional>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "graph.hpp"
+#include "graphGenerator.hpp"
+#include "memoryTracker.hpp"
+
+/* =======================
+   I/O ACCOUNTING
+   ======================= */
+
+struct ExternalIoStats {
+    long long adjacency_bytes = 0;     // adjacency scanned through the mapping
+    long long spill_bytes_written = 0; // queue entries appended to spill files
+    long long spill_bytes_read = 0;    // queue entries read back
+    long long spill_flushes = 0;       // buffer-to-file appends
+    long long buckets = 0;             // buckets settled
+    long long range_splits = 0;        // key ranges narrowed to fit the budget
+    long long stale_entries = 0;       // popped entries already improved
+};
+
+// Bytes this process made the kernel read from / write to storage (Linux
+// /proc/self/io); page-cache hits do not count. Zero where unavailable.
+struct ProcIo {
+    long long read_bytes = 0;
+    long long write_bytes = 0;
+};
+
+inline ProcIo readProcIo() {
+    ProcIo io;
+    std::ifstream in("/proc/self/io");
+    std::string key;
+    long long value;
+    while (in >> key >> value) {
+        if (key == "read_bytes:") io.read_bytes = value;
+        else if (key == "write_bytes:") io.write_bytes = value;
+    }
+    return io;
+}
+
+inline std::runtime_error systemError(const std::string& what, const std::string& path) {
+    return std::runtime_error(what + " " + path + ": " + strerror(errno));
+}
+
+/* =======================
+   CSR FILE
+   ======================= */
+
+static const char CSR_FILE_MAGIC[4] = {'C', 'S', 'R', 'G'};
+static const uint32_t CSR_FILE_VERSION = 1;
+
+struct CsrFileHeader {
+    char magic[4];
+    uint32_t version;
+    int64_t V;
+    int64_t entries;   // directed entries = 2 * undirected edges
+    int32_t maxWeight;
+    int32_t reserved;
+};
+
+struct CsrEntry {
+    int32_t v, w;
+};
+
+inline size_t csrFileSize(int64_t V, int64_t entries) {
+    return sizeof(CsrFileHeader) + (V + 1) * sizeof(uint64_t) + entries * sizeof(CsrEntry);
+}
+
+// Writable mapping of a new file of the given size
+struct MappedOutputFile {
+    int fd = -1;
+    char* data = nullptr;
+    size_t size = 0;
+
+    MappedOutputFile(const std::string& path, size_t bytes) : size(bytes) {
+        fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) throw systemError("cannot create", path);
+        if (ftruncate(fd, bytes) != 0) throw systemError("cannot size", path);
+        void* p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (p == MAP_FAILED) throw systemError("cannot map", path);
+        data = (char*)p;
+    }
+
+    ~MappedOutputFile() {
+        if (data) munmap(data, size);
+        if (fd >= 0) close(fd);
+    }
+
+    MappedOutputFile(const MappedOutputFile&) = delete;
+    MappedOutputFile& operator=(const MappedOutputFile&) = delete;
+};
+
+// forEachChunk(sink) must call sink(const std::vector<Edge>&) for every
+// chunk of the edge list, and is called twice (degree count, then fill), so
+// the edge list itself never has to be in memory. Per-vertex degrees and
+// write cursors (O(V)) are.
+template <typename ForEachChunk>
+void writeCsrFile(const std::string& path, int n, ForEachChunk forEachChunk) {
+    ScratchVector<uint64_t> offsets(n + 1, 0);
+    int32_t maxWeight = 0;
+    forEachChunk([&](const std::vector<Edge>& chunk) {
+        for (const Edge& e : chunk) {
+            offsets[e.u + 1]++;
+            offsets[e.v + 1]++;
+            maxWeight = std::max(maxWeight, (int32_t)e.w);
+        }
+    });
+    for (int v = 0; v < n; v++) offsets[v + 1] += offsets[v];
+    int64_t entries = offsets[n];
+
+    MappedOutputFile out(path, csrFileSize(n, entries));
+    CsrFileHeader header;
+    memcpy(header.magic, CSR_FILE_MAGIC, 4);
+    header.version = CSR_FILE_VERSION;
+    header.V = n;
+    header.entries = entries;
+    header.maxWeight = maxWeight;
+    header.reserved = 0;
+    memcpy(out.data, &header, sizeof(header));
+    memcpy(out.data + sizeof(header), offsets.data(), (n + 1) * sizeof(uint64_t));
+
+    CsrEntry* adj = (CsrEntry*)(out.data + sizeof(header) + (n + 1) * sizeof(uint64_t));
+    ScratchVector<uint64_t> cursor(offsets.begin(), offsets.end() - 1);
+    forEachChunk([&](const std::vector<Edge>& chunk) {
+        for (const Edge& e : chunk) {
+            adj[cursor[e.u]++] = {e.v, e.w};
+            adj[cursor[e.v]++] = {e.u, e.w};
+        }
+    });
+}
+
+// Same layout from an in-memory graph (adjacency order is preserved)
+inline void writeCsrFile(const std::string& path, const Graph& g) {
+    int64_t entries = 0;
+    int32_t maxWeight = 0;
+    for (int u = 0; u < g.V; u++) {
+        entries += g.neighbors(u).size();
+        for (auto [v, w] : g.neighbors(u)) maxWeight = std::max(maxWeight, w);
+    }
+
+    MappedOutputFile out(path, csrFileSize(g.V, entries));
+    CsrFileHeader header;
+    memcpy(header.magic, CSR_FILE_MAGIC, 4);
+    header.version = CSR_FILE_VERSION;
+    header.V = g.V;
+    header.entries = entries;
+    header.maxWeight = maxWeight;
+    header.reserved = 0;
+    memcpy(out.data, &header, sizeof(header));
+
+    uint64_t* offsets = (uint64_t*)(out.data + sizeof(header));
+    CsrEntry* adj = (CsrEntry*)(offsets + g.V + 1);
+    uint64_t pos = 0;
+    for (int u = 0; u < g.V; u++) {
+        offsets[u] = pos;
+        for (auto [v, w] : g.neighbors(u)) adj[pos++] = {v, w};
+    }
+    offsets[g.V] = pos;
+}
+
+// Read-only view of a CSR file; adjacency is paged in on demand
+class MappedCsrGraph {
+    public:
+        struct Range {
+            const CsrEntry* first;
+            const CsrEntry* last;
+            const CsrEntry* begin() const { return first; }
+            const CsrEntry* end() const { return last; }
+            size_t size() const { return last - first; }
+        };
+
+        int V = 0;
+        int64_t entries = 0;
+        int maxWeight = 0;
+
+        explicit MappedCsrGraph(const std::string& path) {
+            fd = open(path.c_str(), O_RDONLY);
+            if (fd < 0) throw systemError("cannot open", path);
+            struct stat st;
+            if (fstat(fd, &st) != 0) throw systemError("cannot stat", path);
+            size = st.st_size;
+            if (size < sizeof(CsrFileHeader)) throw std::runtime_error("not a CSR graph file: " + path);
+
+            void* p = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+            if (p == MAP_FAILED) throw systemError("cannot map", path);
+            data = (const char*)p;
+
+            CsrFileHeader header;
+            memcpy(&header, data, sizeof(header));
+            if (memcmp(header.magic, CSR_FILE_MAGIC, 4) != 0) throw std::runtime_error("not a CSR graph file: " + path);
+            if (header.version != CSR_FILE_VERSION) throw std::runtime_error("unsupported CSR graph version: " + path);
+            if (size != csrFileSize(header.V, header.entries)) throw std::runtime_error("truncated CSR graph file: " + path);
+
+            V = (int)header.V;
+            entries = header.entries;
+            maxWeight = header.maxWeight;
+            offsets = (const uint64_t*)(data + sizeof(CsrFileHeader));
+            adj = (const CsrEntry*)(offsets + V + 1);
+
+            // Dijkstra visits vertices in distance order, not file order
+            madvise((void*)data, size, MADV_RANDOM);
+        }
+
+        ~MappedCsrGraph() {
+            if (data) munmap((void*)data, size);
+            if (fd >= 0) close(fd);
+        }
+
+        MappedCsrGraph(const MappedCsrGraph&) = delete;
+        MappedCsrGraph& operator=(const MappedCsrGraph&) = delete;
+
+        Range neighbors(int u) const {
+            return {adj + offsets[u], adj + offsets[u + 1]};
+        }
+
+    private:
+        int fd = -1;
+        const char* data = nullptr;
+        size_t size = 0;
+        const uint64_t* offsets = nullptr;
+        const CsrEntry* adj = nullptr;
+};
+
+/* =======================
+   MAPPED SCRATCH ARRAY
+   ======================= */
+
+// Fixed-size array backed by an unlinked file in dir, so the kernel can
+// write it back instead of it counting against RAM
+template <typename T>
+class MappedArray {
+    public:
+        MappedArray(const std::string& dir, size_t count) : n(count) {
+            std::string path = dir + "/mapped_array_XXXXXX";
+            std::vector<char> name(path.begin(), path.end());
+            name.push_back('\0');
+            fd = mkstemp(name.data());
+            if (fd < 0) throw systemError("cannot create scratch file in", dir);
+            unlink(name.data());
+            bytes = std::max<size_t>(count * sizeof(T), 1);
+            if (ftruncate(fd, bytes) != 0) throw systemError("cannot size scratch file in", dir);
+            void* p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (p == MAP_FAILED) throw systemError("cannot map scratch file in", dir);
+            data = (T*)p;
+        }
+
+        ~MappedArray() {
+            if (data) munmap(data, bytes);
+            if (fd >= 0) close(fd);
+        }
+
+        MappedArray(const MappedArray&) = delete;
+        MappedArray& operator=(const MappedArray&) = delete;
+
+        T& operator[](size_t i) { return data[i]; }
+        const T& operator[](size_t i) const { return data[i]; }
+        size_t size() const { return n; }
+        void fill(const T& value) { std::fill(data, data + n, value); }
+
+    private:
+        int fd = -1;
+        T* data = nullptr;
+        size_t n = 0;
+        size_t bytes = 0;
+};
+
+/* =======================
+   BUCKETED SPILLING QUEUE
+   ======================= */
+
+// Monotone priority queue: a push is never below the last popped key.
+// Buckets cover disjoint key ranges [lo, end), width wide unless narrowed.
+// RAM use is fixed at construction: half the budget is the heap of the
+// current range, half is one append buffer shared by all later buckets.
+class ExternalBucketQueue {
+    public:
+        struct Entry {
+            int64_t d;
+            int32_t v;
+            int32_t reserved;
+            bool operator>(const Entry& o) const { return d > o.d; }
+        };
+
+        ExternalBucketQueue(const std::string& dir, int64_t bucketWidth, size_t memoryEntries,
+                            ExternalIoStats& io)
+            : dir(dir), width(std::max<int64_t>(bucketWidth, 1)), io(io) {
+            size_t budget = budgetEntries(memoryEntries);
+            activeCap = budget / 2;
+            active.reserve(activeCap);
+            buffer.reserve(budget - activeCap);
+        }
+
+        ~ExternalBucketQueue() {
+            for (auto& [lo, b] : buckets) {
+                if (!b.path.empty()) unlink(b.path.c_str());
+            }
+            if (!spillDir.empty()) rmdir(spillDir.c_str());
+        }
+
+        ExternalBucketQueue(const ExternalBucketQueue&) = delete;
+        ExternalBucketQueue& operator=(const ExternalBucketQueue&) = delete;
+
+        // Entries held in RAM for a memory_entries setting
+        static size_t budgetEntries(size_t memoryEntries) {
+            return std::max<size_t>(memoryEntries, 1024);
+        }
+
+        void push(int64_t d, int v) {
+            if (d < currentEnd && active.size() == activeCap) shrinkActive();
+            if (d < currentEnd) {
+                active.push_back({d, v, 0});
+                std::push_heap(active.begin(), active.end(), std::greater<Entry>());
+                return;
+            }
+            coverKey(d);
+            if (buffer.size() == buffer.capacity()) spillBuffer();
+            buffer.push_back({d, v, 0});
+        }
+
+        bool pop(int64_t& d, int& v) {
+            while (active.empty()) {
+                if (buckets.empty()) return false;
+                loadNextBucket();
+            }
+            std::pop_heap(active.begin(), active.end(), std::greater<Entry>());
+            d = active.back().d;
+            v = active.back().v;
+            active.pop_back();
+            return true;
+        }
+
+    private:
+        struct Bucket {
+            int64_t end;          // keys in [lo, end)
+            std::string path;     // spill file, empty until the first spill
+            size_t spilled = 0;   // entries in the spill file
+            size_t consumed = 0;  // of those, already loaded
+
+            explicit Bucket(int64_t end) : end(end) {}
+        };
+
+        static constexpr size_t READ_CHUNK = 1 << 16; // entries per sequential read
+
+        std::string dir;
+        std::string spillDir;     // private mkdtemp directory, made on first spill
+        int64_t width;
+        size_t activeCap;
+        ExternalIoStats& io;
+        std::map<int64_t, Bucket> buckets;  // by lo
+        HeapScratchVector<Entry> active;    // binary heap of the current range
+        HeapScratchVector<Entry> buffer;    // unspilled entries of any bucket
+        int64_t currentEnd = 0;             // current range ends here
+
+        static bool byDist(const Entry& a, const Entry& b) { return a.d < b.d; }
+
+        // Makes sure some bucket's range contains d (d >= currentEnd)
+        void coverKey(int64_t d) {
+            auto next = buckets.upper_bound(d);
+            int64_t lo = std::max(d / width * width, currentEnd);
+            int64_t end = d / width * width + width;
+            if (next != buckets.begin()) {
+                auto prev = std::prev(next);
+                if (prev->second.end > d) return;
+                lo = std::max(lo, prev->second.end);
+            }
+            if (next != buckets.end()) end = std::min(end, next->first);
+            buckets.emplace_hint(next, lo, Bucket{end});
+        }
+
+        // Frees half of a full heap by narrowing the current range to the
+        // lower half of its keys; the upper part becomes its own bucket. If
+        // most entries share the smallest key, the surplus of that key goes
+        // to a one-key bucket, which is loaded a heap's worth at a time.
+        void shrinkActive() {
+            io.range_splits++;
+            auto mid = active.begin() + active.size() / 2;
+            std::nth_element(active.begin(), mid, active.end(), byDist);
+            int64_t low = std::min_element(active.begin(), mid + 1, byDist)->d;
+            int64_t split = mid->d > low ? mid->d : low + 1;
+            if (split < currentEnd) {
+                // A one-key bucket may already own part of [split, currentEnd)
+                auto next = buckets.lower_bound(split);
+                if (next == buckets.end() || next->first != split) {
+                    int64_t end = next != buckets.end() ? std::min(currentEnd, next->first) : currentEnd;
+                    buckets.emplace_hint(next, split, Bucket{end});
+                }
+                currentEnd = split;
+            }
+
+            auto keep = std::partition(active.begin(), active.end(),
+                                       [&](const Entry& e) { return e.d < currentEnd; });
+            if ((size_t)(keep - active.begin()) > activeCap / 2) {
+                // Everything kept has key low, so any of it can wait
+                buckets.try_emplace(low, Bucket{low + 1});
+                keep = active.begin() + activeCap / 2;
+            }
+
+            size_t moved = active.end() - keep;
+            if (buffer.size() + moved > buffer.capacity()) spillBuffer();
+            buffer.insert(buffer.end(), keep, active.end());
+            active.erase(keep, active.end());
+            std::make_heap(active.begin(), active.end(), std::greater<Entry>());
+        }
+
+        // Sorts the buffer by key and appends each bucket's run to its
+        // spill file, so every flush is one sequential write per bucket
+        void spillBuffer() {
+            std::sort(buffer.begin(), buffer.end(), byDist);
+            auto it = buckets.begin();
+            for (size_t i = 0; i < buffer.size();) {
+                while (it->second.end <= buffer[i].d) ++it;
+                size_t j = i;
+                while (j < buffer.size() && buffer[j].d < it->second.end) j++;
+                append(it->second, buffer.data() + i, j - i);
+                i = j;
+            }
+            buffer.clear();
+        }
+
+        void append(Bucket& b, const Entry* entries, size_t count) {
+            if (b.path.empty()) b.path = createSpillFile();
+            int fd = open(b.path.c_str(), O_WRONLY | O_APPEND);
+            if (fd < 0) throw systemError("cannot open spill file", b.path);
+            writeAll(fd, entries, count * sizeof(Entry), b.path);
+            close(fd);
+
+            b.spilled += count;
+            io.spill_bytes_written += count * sizeof(Entry);
+            io.spill_flushes++;
+        }
+
+        // New empty file in this queue's own directory, so no other queue
+        // or earlier run can collide with it
+        std::string createSpillFile() {
+            if (spillDir.empty()) {
+                std::string path = dir + "/bucket_queue_XXXXXX";
+                std::vector<char> name(path.begin(), path.end());
+                name.push_back('\0');
+                if (!mkdtemp(name.data())) throw systemError("cannot create spill directory in", dir);
+                spillDir = name.data();
+            }
+            std::string path = spillDir + "/bucket_XXXXXX";
+            std::vector<char> name(path.begin(), path.end());
+            name.push_back('\0');
+            int fd = mkstemp(name.data());
+            if (fd < 0) throw systemError("cannot create spill file in", spillDir);
+            close(fd);
+            return name.data();
+        }
+
+        void loadNextBucket() {
+            auto it = buckets.begin();
+            int64_t lo = it->first;
+            Bucket& b = it->second;
+            auto inRange = [&](const Entry& e) { return e.d >= lo && e.d < b.end; };
+
+            size_t pending = b.spilled - b.consumed + std::count_if(buffer.begin(), buffer.end(), inRange);
+            if (pending > activeCap && b.end - lo > 1) {
+                splitBucket(it);
+                return;
+            }
+            currentEnd = b.end;
+            io.buckets++;
+
+            // A one-key bucket larger than the heap is loaded in chunks
+            active.clear();
+            if (b.consumed < b.spilled) {
+                size_t count = std::min(activeCap, b.spilled - b.consumed);
+                active.resize(count);
+                readSpill(b, active.data(), count);
+            }
+            auto rest = std::partition(buffer.begin(), buffer.end(),
+                                       [&](const Entry& e) { return !inRange(e); });
+            size_t take = std::min<size_t>(buffer.end() - rest, activeCap - active.size());
+            active.insert(active.end(), rest, rest + take);
+            buffer.erase(rest, rest + take);
+
+            if (b.consumed == b.spilled && std::none_of(buffer.begin(), buffer.end(), inRange)) {
+                buckets.erase(it);
+            }
+            std::make_heap(active.begin(), active.end(), std::greater<Entry>());
+        }
+
+        // Halves a bucket's range; its spilled entries stream back through
+        // the buffer, which routes each to its half. Repeats as needed
+        // until the first bucket fits the heap.
+        void splitBucket(std::map<int64_t, Bucket>::iterator it) {
+            io.range_splits++;
+            int64_t lo = it->first, end = it->second.end, mid = lo + (end - lo) / 2;
+            Bucket old = std::move(it->second);
+            buckets.erase(it);
+            buckets.emplace(lo, Bucket{mid});
+            buckets.emplace(mid, Bucket{end});
+
+            while (old.consumed < old.spilled) {
+                if (buffer.size() == buffer.capacity()) spillBuffer();
+                size_t at = buffer.size();
+                size_t count = std::min({old.spilled - old.consumed, buffer.capacity() - at, READ_CHUNK});
+                buffer.resize(at + count);
+                readSpill(old, buffer.data() + at, count);
+            }
+        }
+
+        // Reads the next count entries of b's spill file; removes the file
+        // once it is fully consumed
+        void readSpill(Bucket& b, Entry* out, size_t count) {
+            int fd = open(b.path.c_str(), O_RDONLY);
+            if (fd < 0) throw systemError("cannot open spill file", b.path);
+            posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+            if (lseek(fd, (off_t)(b.consumed * sizeof(Entry)), SEEK_SET) < 0) {
+                close(fd);
+                throw systemError("cannot seek spill file", b.path);
+            }
+            for (size_t done = 0; done < count; done += READ_CHUNK) {
+                readAll(fd, out + done, std::min(READ_CHUNK, count - done) * sizeof(Entry), b.path);
+            }
+            close(fd);
+
+            b.consumed += count;
+            io.spill_bytes_read += count * sizeof(Entry);
+            if (b.consumed == b.spilled) {
+                unlink(b.path.c_str());
+                b = Bucket{b.end};
+            }
+        }
+
+        static void writeAll(int fd, const void* p, size_t bytes, const std::string& path) {
+            const char* c = (const char*)p;
+            while (bytes) {
+                ssize_t r = write(fd, c, bytes);
+                if (r < 0 && errno == EINTR) continue;
+                if (r <= 0) throw systemError("cannot write spill file", path);
+                c += r;
+                bytes -= r;
+            }
+        }
+
+        static void readAll(int fd, void* p, size_t bytes, const std::string& path) {
+            char* c = (char*)p;
+            while (bytes) {
+                ssize_t r = read(fd, c, bytes);
+                if (r < 0 && errno == EINTR) continue;
+                if (r <= 0) throw systemError("cannot read spill file", path);
+                c += r;
+                bytes -= r;
+            }
+        }
+};
+
+/* =======================
+   DIJKSTRA
+   ======================= */
+
+struct ExternalDijkstraOptions {
+    std::string spill_dir = "/tmp";
+    int64_t bucket_width = 0;          // 0 = graph's max edge weight
+    size_t memory_entries = 1 << 22;   // queue entries held in RAM (16 B each)
+};
+
+// Fills dist (INT_MAX = unreachable) and returns the number of vertices
+// settled
+template <typename CsrGraph>
+long long externalDijkstra(const CsrGraph& g, int src, MappedArray<int>& dist,
+                           const ExternalDijkstraOptions& opt, ExternalIoStats& io) {
+    dist.fill(INT_MAX);
+    int64_t width = opt.bucket_width > 0 ? opt.bucket_width : std::max(g.maxWeight, 1);
+    ExternalBucketQueue pq(opt.spill_dir, width, opt.memory_entries, io);
+
+    long long settled = 0;
+    dist[src] = 0;
+    pq.push(0, src);
+
+    int64_t d;
+    int u;
+    while (pq.pop(d, u)) {
+        if (d > dist[u]) {
+            io.stale_entries++;
+            continue;
+        }
+        settled++;
+
+        auto range = g.neighbors(u);
+        io.adjacency_bytes += range.size() * sizeof(CsrEntry);
+        for (auto [v, w] : range) {
+            int64_t nd = d + w;
+            if (nd < dist[v]) {
+                dist[v] = (int)nd;
+                pq.push(nd, v);
+            }
+        }
+    }
+    return settled;
+}
+
+#endif // EXTERNAL_DIJKSTRA_HPP
@@ -0,0 +1,39 @@
+/*
+ * GRAPH
+ * Undirected weighted graph stored as adjacency lists of (neighbor, weight).
+ * Shared by the Dijkstra/Prim drivers and the graph generators.
+ */
+
+#ifndef GRAPH_HPP
+#define GRAPH_HPP
+
+#include <vector>
+#include <utility>
+#include "memoryTracker.hpp"
+
+// (neighbor, weight) list of one vertex; counted under MEM_GRAPH
+typedef GraphVector<std::pair<int,int>> AdjList;
+
+struct Graph {
+    int V;
+    GraphVector<AdjList> adj;
+
+    Graph(int vertices) : V(vertices), adj(vertices) {}
+
+    void addEdge(int u, int v, int w) {
+        adj[u].push_back({v, w});
+        adj[v].push_back({u, w});
+    }
+
+    const AdjList& neighbors(int u) const {
+        return adj[u];
+    }
+
+    long long edgeCount() const {
+        long long total = 0;
+        for (const auto& list : adj) total += list.size();
+        return total / 2;
+    }
+};
+
+#endif // GRAPH_HPP
@@ -0,0 +1,62 @@
+/*
+ * GRAPH GENERATOR TOOL
+ * Writes a generated graph as "u v w" lines to stdout.
+ *
+ * Usage:
+ *   graphGen gnm  <n> <m>          [seed] [threads]
+ *   graphGen rmat <scale> <m>      [seed] [threads]
+ *   graphGen grid <rows> <cols>    [seed] [threads]
+ *   graphGen rgg  <n> <radius>     [seed] [threads]
+ *
+ * gnm and rmat are streamed in chunks, so edge counts far beyond RAM work.
+ * The first line is "<n> <m>" when the edge count is known up front.
+ */
+
+#include <bits/stdc++.h>
+#include "graphGenerator.hpp"
+
+using namespace std;
+
+int main(int argc, char** argv) {
+    if (argc < 4) {
+        cerr << "usage: " << argv[0] << " gnm|rmat|grid|rgg <a> <b> [seed] [threads]\n";
+        return 1;
+    }
+
+    string family = argv[1];
+    GenOptions opt;
+    if (argc > 4) opt.seed = stoull(argv[4]);
+    if (argc > 5) opt.threads = stoi(argv[5]);
+
+    ios::sync_with_stdio(false);
+    EdgeListWriter writer(cout);
+
+    if (family == "gnm") {
+        int n = stoi(argv[2]);
+        long long m = stoll(argv[3]);
+        cout << n << ' ' << m << '\n';
+        streamGnm(n, m, opt, writer);
+    } else if (family == "rmat") {
+        int scale = stoi(argv[2]);
+        long long m = stoll(argv[3]);
+        cout << (1 << scale) << ' ' << m << '\n';
+        streamRmat(scale, m, opt, writer);
+    } else if (family == "grid") {
+        int rows = stoi(argv[2]), cols = stoi(argv[3]);
+        vector<Edge> edges = generateGrid(rows, cols, opt);
+        cout << (long long)rows * cols << ' ' << edges.size() << '\n';
+        writer(edges);
+    } else if (family == "rgg") {
+        int n = stoi(argv[2]);
+        double radius = stod(argv[3]);
+        vector<Edge> edges = generateGeometric(n, radius, opt);
+        cout << n << ' ' << edges.size() << '\n';
+        writer(edges);
+    } else {
+        cerr << "unknown family: " << family << "\n";
+        return 1;
+    }
+
+    cerr << "Wrote " << writer.written << " edges\n";
+    return 0;
+}
@@ -0,0 +1,429 @@
+/*
+ * GRAPH GENERATORS
+ *
+ * Reproducible random graph families for the Dijkstra/Prim benchmarks.
+ *
+ * Randomness comes from a counter-based generator: every random value is a
+ * pure function of (seed, edge index, draw index), so edges can be built by
+ * any number of threads and the output is identical for every thread count.
+ * Bounded integers use Lemire's rejection method (no modulo bias).
+ *
+ * PUBLIC INTERFACE:
+ * ------------------------------------------------
+ * GenOptions opt;                                  // seed, weight range, dedup, threads
+ * vector<Edge> e = generateGnm(n, m, opt);         // Erdos-Renyi G(n,m); with dedup
+ *                                                  // exactly min(m, n(n-1)/2) edges
+ * vector<Edge> e = generateRmat(scale, m, opt);    // R-MAT / Kronecker, n = 2^scale;
+ *                                                  // dedup may leave fewer than m
+ * vector<Edge> e = generateGrid(rows, cols, opt);  // 2D grid, road-like
+ * vector<Edge> e = generateGeometric(n, r, opt);   // random geometric in unit square
+ * Graph g = toGraph(n, e);
+ *
+ * streamGnm(n, m, opt, sink);   // chunked output for graphs that do not fit
+ * streamRmat(scale, m, opt, sink);
+ * vector<Edge> e = readEdgeList(in, n);  // graphGen output back in; throws on
+ *                                       // endpoints outside [0, n)
+ */
+
+#ifndef GRAPH_GENERATOR_HPP
+#define GRAPH_GENERATOR_HPP
+
+#include <vector>
+#include <thread>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include <ostream>
+#include <istream>
+#include <string>
+#include <charconv>
+#include <stdexcept>
+#include "graph.hpp"
+
+struct Edge {
+    int u, v, w;
+};
+
+struct GenOptions {
+    uint64_t seed = 0;
+    int minWeight = 1;
+    int maxWeight = 100;
+    bool dedup = false;      // no parallel edges (keeps the lightest); G(n,m)
+                             // resamples, R-MAT only drops
+    int threads = 0;         // 0 = hardware concurrency
+    double keepProb = 1.0;   // grid only: probability each grid edge exists
+    double a = 0.57, b = 0.19, c = 0.19; // R-MAT quadrant probabilities (d = 1-a-b-c)
+};
+
+/* =======================
+   COUNTER-BASED RNG
+   ======================= */
+
+// SplitMix64 finalizer
+inline uint64_t rngMix(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+// Random 64-bit value for draw number `draw` of item `index`
+inline uint64_t rngAt(uint64_t seed, uint64_t index, uint64_t draw) {
+    return rngMix(rngMix(seed ^ (index * 0xd1b54a32d192ed03ULL)) + draw);
+}
+
+// Uniform integer in [0, bound); consumes draws starting at `draw`
+inline uint32_t rngBounded(uint64_t seed, uint64_t index, uint64_t& draw, uint32_t bound) {
+    uint32_t threshold = (uint32_t)(-bound) % bound;
+    while (true) {
+        uint64_t m = (uint64_t)(uint32_t)rngAt(seed, index, draw++) * bound;
+        if ((uint32_t)m >= threshold) return (uint32_t)(m >> 32);
+    }
+}
+
+// Uniform double in [0, 1)
+inline double rngUnit(uint64_t seed, uint64_t index, uint64_t draw) {
+    return (rngAt(seed, index, draw) >> 11) * 0x1.0p-53;
+}
+
+inline int rngWeight(const GenOptions& opt, uint64_t index, uint64_t& draw) {
+    return opt.minWeight + (int)rngBounded(opt.seed, index, draw,
+                                           (uint32_t)(opt.maxWeight - opt.minWeight + 1));
+}
+
+/* =======================
+   HELPERS
+   ======================= */
+
+inline int genThreads(const GenOptions& opt) {
+    if (opt.threads > 0) return opt.threads;
+    unsigned hw = std::thread::hardware_concurrency();
+    return hw ? (int)hw : 1;
+}
+
+// Runs fn(begin, end, tid) over [0, total) split into contiguous blocks
+template <typename Fn>
+void parallelBlocks(long long total, int threads, Fn fn) {
+    if (threads <= 1 || total < 4096) {
+        fn(0LL, total, 0);
+        return;
+    }
+    std::vector<std::thread> pool;
+    long long block = (total + threads - 1) / threads;
+    for (int t = 0; t < threads; t++) {
+        long long begin = std::min(total, t * block);
+        long long end = std::min(total, begin + block);
+        pool.emplace_back(fn, begin, end, t);
+    }
+    for (auto& th : pool) th.join();
+}
+
+// Sorts by (min endpoint, max endpoint, weight) and keeps the lightest copy
+inline void dedupEdges(std::vector<Edge>& edges) {
+    for (auto& e : edges) {
+        if (e.u > e.v) std::swap(e.u, e.v);
+    }
+    std::sort(edges.begin(), edges.end(), [](const Edge& x, const Edge& y) {
+        if (x.u != y.u) return x.u < y.u;
+        if (x.v != y.v) return x.v < y.v;
+        return x.w < y.w;
+    });
+    edges.erase(std::unique(edges.begin(), edges.end(), [](const Edge& x, const Edge& y) {
+        return x.u == y.u && x.v == y.v;
+    }), edges.end());
+}
+
+// Fills edges[i] = edgeAt(i) for i in [0, m) in parallel
+template <typename EdgeFn>
+std::vector<Edge> generateIndexed(long long m, const GenOptions& opt, EdgeFn edgeAt) {
+    std::vector<Edge> edges(m);
+    parallelBlocks(m, genThreads(opt), [&](long long begin, long long end, int) {
+        for (long long i = begin; i < end; i++) edges[i] = edgeAt(i);
+    });
+    if (opt.dedup) dedupEdges(edges);
+    return edges;
+}
+
+// Calls sink(const vector<Edge>&) once per chunk; edge i is the same edge
+// generateIndexed would produce. Dedup is not applied to streamed output.
+template <typename EdgeFn, typename Sink>
+void streamIndexed(long long m, const GenOptions& opt, EdgeFn edgeAt, Sink&& sink,
+                   long long chunk = 1 << 22) {
+    std::vector<Edge> buffer;
+    for (long long base = 0; base < m; base += chunk) {
+        long long count = std::min(chunk, m - base);
+        buffer.resize(count);
+        parallelBlocks(count, genThreads(opt), [&](long long begin, long long end, int) {
+            for (long long i = begin; i < end; i++) buffer[i] = edgeAt(base + i);
+        });
+        sink(buffer);
+    }
+}
+
+/* =======================
+   ERDOS-RENYI G(n,m)
+   ======================= */
+
+// Edge i of G(n,m): uniform endpoints, self-loops resampled
+inline Edge gnmEdge(int n, long long i, const GenOptions& opt) {
+    uint64_t draw = 0;
+    int u, v;
+    do {
+        u = (int)rngBounded(opt.seed, i, draw, n);
+        v = (int)rngBounded(opt.seed, i, draw, n);
+    } while (u == v && n > 1);
+    return {u, v, rngWeight(opt, i, draw)};
+}
+
+// m distinct edges: duplicates are dropped and replaced by further edge
+// indices until m remain. Each round draws only the shortfall, so this
+// stays cheap while m is at most half of all pairs.
+inline std::vector<Edge> gnmDistinctEdges(int n, long long m, const GenOptions& opt) {
+    GenOptions plain = opt;
+    plain.dedup = false;
+    std::vector<Edge> edges;
+    long long next = 0;
+    while ((long long)edges.size() < m) {
+        long long count = m - (long long)edges.size();
+        std::vector<Edge> more = generateIndexed(count, plain, [&](long long i) { return gnmEdge(n, next + i, opt); });
+        next += count;
+        edges.insert(edges.end(), more.begin(), more.end());
+        dedupEdges(edges);
+    }
+    return edges;
+}
+
+// With opt.dedup, exactly min(m, n(n-1)/2) distinct edges. Above half of
+// all pairs the missing pairs are sampled instead, and every other pair is
+// emitted with a weight drawn from its pair index.
+inline std::vector<Edge> generateGnm(int n, long long m, const GenOptions& opt = GenOptions()) {
+    if (!opt.dedup) return generateIndexed(m, opt, [&](long long i) { return gnmEdge(n, i, opt); });
+
+    long long pairs = (long long)n * (n - 1) / 2;
+    m = std::min(m, pairs);
+    if (m <= pairs / 2) return gnmDistinctEdges(n, m, opt);
+
+    std::vector<Edge> missing = gnmDistinctEdges(n, pairs - m, opt); // sorted, u < v
+    GenOptions weights = opt;
+    weights.seed = rngMix(opt.seed ^ 0x5851f42d4c957f2dULL); // apart from the edge draws
+    std::vector<Edge> edges;
+    edges.reserve(m);
+    size_t skip = 0;
+    for (int u = 0; u < n; u++) {
+        for (int v = u + 1; v < n; v++) {
+            if (skip < missing.size() && missing[skip].u == u && missing[skip].v == v) {
+                skip++;
+                continue;
+            }
+            uint64_t draw = 0;
+            edges.push_back({u, v, rngWeight(weights, (uint64_t)u * n + v, draw)});
+        }
+    }
+    return edges;
+}
+
+template <typename Sink>
+void streamGnm(int n, long long m, const GenOptions& opt, Sink&& sink) {
+    streamIndexed(m, opt, [&](long long i) { return gnmEdge(n, i, opt); }, sink);
+}
+
+/* =======================
+   R-MAT / KRONECKER
+   ======================= */
+
+// Edge i of R-MAT: one quadrant choice per bit of the vertex id
+inline Edge rmatEdge(int scale, long long i, const GenOptions& opt) {
+    uint64_t draw = 0;
+    int u, v;
+    do {
+        u = 0;
+        v = 0;
+        for (int bit = 0; bit < scale; bit++) {
+            double r = rngUnit(opt.seed, i, draw++);
+            u <<= 1;
+            v <<= 1;
+            if (r < opt.a) {
+                // top-left
+            } else if (r < opt.a + opt.b) {
+                v |= 1;
+            } else if (r < opt.a + opt.b + opt.c) {
+                u |= 1;
+            } else {
+                u |= 1;
+                v |= 1;
+            }
+        }
+    } while (u == v && scale > 0);
+    return {u, v, rngWeight(opt, i, draw)};
+}
+
+inline std::vector<Edge> generateRmat(int scale, long long m, const GenOptions& opt = GenOptions()) {
+    return generateIndexed(m, opt, [&](long long i) { return rmatEdge(scale, i, opt); });
+}
+
+template <typename Sink>
+void streamRmat(int scale, long long m, const GenOptions& opt, Sink&& sink) {
+    streamIndexed(m, opt, [&](long long i) { return rmatEdge(scale, i, opt); }, sink);
+}
+
+/* =======================
+   2D GRID (ROAD-LIKE)
+   ======================= */
+
+// Vertex id = r * cols + c. Each cell owns its right and down edge; with
+// keepProb < 1 some edges are dropped to mimic an irregular road network.
+inline std::vector<Edge> generateGrid(int rows, int cols, const GenOptions& opt = GenOptions()) {
+    long long cells = (long long)rows * cols;
+    int threads = genThreads(opt);
+    std::vector<std::vector<Edge>> parts(threads);
+
+    parallelBlocks(cells, threads, [&](long long begin, long long end, int tid) {
+        auto& out = parts[tid];
+        for (long long id = begin; id < end; id++) {
+            int r = (int)(id / cols), c = (int)(id % cols);
+            for (int dir = 0; dir < 2; dir++) {
+                int nr = r + dir, nc = c + (1 - dir);
+                if (nr >= rows || nc >= cols) continue;
+                uint64_t index = 2 * id + dir;
+                uint64_t draw = 0;
+                if (opt.keepProb < 1.0 && rngUnit(opt.seed, index, draw++) >= opt.keepProb) continue;
+                out.push_back({(int)id, nr * cols + nc, rngWeight(opt, index, draw)});
+            }
+        }
+    });
+
+    std::vector<Edge> edges;
+    for (auto& p : parts) edges.insert(edges.end(), p.begin(), p.end());
+    return edges;
+}
+
+/* =======================
+   RANDOM GEOMETRIC
+   ======================= */
+
+// n points uniform in the unit square, an edge between every pair closer
+// than radius. Weight grows linearly with distance over [minWeight, maxWeight].
+inline std::vector<Edge> generateGeometric(int n, double radius, const GenOptions& opt = GenOptions()) {
+    std::vector<double> x(n), y(n);
+    for (int i = 0; i < n; i++) {
+        x[i] = rngUnit(opt.seed, i, 0);
+        y[i] = rngUnit(opt.seed, i, 1);
+    }
+
+    // Bucket points into radius-sized cells (counting sort keeps index order)
+    int grid = std::max(1, std::min((int)(1.0 / radius), 1 << 15));
+    auto cellOf = [&](int i) {
+        int cx = std::min(grid - 1, (int)(x[i] * grid));
+        int cy = std::min(grid - 1, (int)(y[i] * grid));
+        return (long long)cy * grid + cx;
+    };
+    long long cells = (long long)grid * grid;
+    std::vector<int> start(cells + 1, 0), points(n);
+    for (int i = 0; i < n; i++) start[cellOf(i) + 1]++;
+    for (long long c = 0; c < cells; c++) start[c + 1] += start[c];
+    std::vector<int> fill(start.begin(), start.end() - 1);
+    for (int i = 0; i < n; i++) points[fill[cellOf(i)]++] = i;
+
+    int threads = genThreads(opt);
+    std::vector<std::vector<Edge>> parts(threads);
+    double r2 = radius * radius;
+    int span = opt.maxWeight - opt.minWeight;
+
+    parallelBlocks(cells, threads, [&](long long begin, long long end, int tid) {
+        auto& out = parts[tid];
+        for (long long cell = begin; cell < end; cell++) {
+            int cx = (int)(cell % grid), cy = (int)(cell / grid);
+            for (int dy = -1; dy <= 1; dy++) {
+                for (int dx = -1; dx <= 1; dx++) {
+                    int nx = cx + dx, ny = cy + dy;
+                    if (nx < 0 || ny < 0 || nx >= grid || ny >= grid) continue;
+                    long long other = (long long)ny * grid + nx;
+                    if (other < cell) continue; // each cell pair visited once
+                    for (int a = start[cell]; a < start[cell + 1]; a++) {
+                        int i = points[a];
+                        int b0 = (other == cell) ? a + 1 : start[other];
+                        for (int b = b0; b < start[other + 1]; b++) {
+                            int j = points[b];
+                            double ddx = x[i] - x[j], ddy = y[i] - y[j];
+                            double d2 = ddx * ddx + ddy * ddy;
+                            if (d2 >= r2) continue;
+                            int w = opt.minWeight + (int)std::lround(span * std::sqrt(d2) / radius);
+                            out.push_back({i, j, w});
+                        }
+                    }
+                }
+            }
+        }
+    });
+
+    std::vector<Edge> edges;
+    for (auto& p : parts) edges.insert(edges.end(), p.begin(), p.end());
+    return edges;
+}
+
+/* =======================
+   OUTPUT
+   ======================= */
+
+inline Graph toGraph(int n, const std::vector<Edge>& edges) {
+    Graph g(n);
+    std::vector<int> degree(n, 0);
+    for (const auto& e : edges) {
+        degree[e.u]++;
+        degree[e.v]++;
+    }
+    for (int v = 0; v < n; v++) g.adj[v].reserve(degree[v]);
+    for (const auto& e : edges) g.addEdge(e.u, e.v, e.w);
+    return g;
+}
+
+// Sink for stream*(): writes "u v w" lines
+struct EdgeListWriter {
+    std::ostream& out;
+    long long written = 0;
+
+    EdgeListWriter(std::ostream& os) : out(os) {}
+
+    void operator()(const std::vector<Edge>& chunk) {
+        std::string buf;
+        buf.reserve(chunk.size() * 20);
+        char num[16];
+        for (const auto& e : chunk) {
+            const int fields[3] = {e.u, e.v, e.w};
+            for (int f = 0; f < 3; f++) {
+                char* end = std::to_chars(num, num + sizeof(num), fields[f]).ptr;
+                buf.append(num, end);
+                buf.push_back(f == 2 ? '\n' : ' ');
+            }
+        }
+        out.write(buf.data(), buf.size());
+        written += chunk.size();
+    }
+};
+
+// Reads the format EdgeListWriter produces, preceded by an "n m" line
+// (as written by graphGen). n is returned through the reference. Throws
+// std::runtime_error on a malformed header or an endpoint outside [0, n).
+inline std::vector<Edge> readEdgeList(std::istream& in, int& n) {
+    long long m = 0;
+    if (!(in >> n >> m) || n < 0 || m < 0) {
+        throw std::runtime_error("edge list: bad \"n m\" header");
+    }
+    std::vector<Edge> edges;
+    edges.reserve(m);
+    Edge e;
+    while (in >> e.u >> e.v >> e.w) {
+        if (e.u < 0 || e.u >= n || e.v < 0 || e.v >= n) {
+            throw std::runtime_error("edge list: edge " + std::to_string(edges.size()) + " (" +
+                                     std::to_string(e.u) + ", " + std::to_string(e.v) +
+                                     ") has an endpoint outside [0, " + std::to_string(n) + ")");
+        }
+        edges.push_back(e);
+    }
+    if (!in.eof()) {
+        throw std::runtime_error("edge list: malformed line after edge " + std::to_string(edges.size()));
+    }
+    return edges;
+}
+
+#endif // GRAPH_GENERATOR_HPP
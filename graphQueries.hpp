@@ -0,0 +1,283 @@
+/*
+ * GRAPH QUERIES
+ *
+ * Reusable shortest-path and MST queries on top of PairingHeap and
+ * QueryWorkspace. A QueryContext owns one heap and one workspace and is
+ * meant to live for the whole life of a worker thread, so a query never
+ * allocates or initializes O(V) state.
+ *
+ * g can be any graph type with V and neighbors(u) yielding (v, w) pairs:
+ * Graph, or CompressedGraph to read fewer bytes per relaxation.
+ *
+ * PUBLIC INTERFACE:
+ * ------------------------------------------------
+ * QueryContext ctx(g.V);
+ * int d = shortestPath(g, s, t, ctx);     // stops when t is settled; INT_MAX if unreachable
+ * shortestPathTree(g, s, ctx);            // settles all of s's component; read ctx.ws.dist(v)
+ * long long w = mstWeight(g, s, ctx);     // Prim over s's component
+ *
+ * multiSourceShortestPaths(g, sources, ctx);   // all sources at distance 0;
+ *                                              // ctx.cell(v) = index of nearest source
+ * VoronoiPartition p = voronoiPartition(g, sources, ctx);  // dist, cell and
+ *                                              // boundary edges of every vertex, one pass
+ *
+ * Optional last arguments of all five: QueryStats* (per-op counts and
+ * times), HeapTraceWriter* (records heap operations for heapReplay)
+ */
+
+#ifndef GRAPH_QUERIES_HPP
+#define GRAPH_QUERIES_HPP
+
+#include <climits>
+#include <vector>
+#include <chrono>
+#include "graph.hpp"
+#include "pairingHeap.hpp"
+#include "queryWorkspace.hpp"
+#include "heapTrace.hpp"
+
+struct QueryContext {
+    PairingHeap pq;
+    QueryWorkspace<HeapNode*> ws;
+    ScratchVector<std::pair<HeapNode*, int>> batch; // decrease_keys buffer
+    WorkspaceVector<int> cellOf; // multi-source: source index owning each seen vertex
+
+    QueryContext(int vertices) : ws(vertices), cellOf(vertices) {}
+    ~QueryContext() { pq.clear(); }
+
+    // Valid after multiSourceShortestPaths; -1 if v was not reached
+    int cell(int v) const { return ws.seen(v) ? cellOf[v] : -1; }
+};
+
+// Per-operation counts and times (microseconds) of one or more queries
+struct QueryStats {
+    long long insert_time = 0;
+    long long extract_time = 0;
+    long long decrease_time = 0;
+
+    long long insert_count = 0;
+    long long extract_count = 0;
+    long long decrease_count = 0;
+
+    long long nodes_allocated = 0;
+};
+
+// Adds the microseconds spent in its scope to *total; no clock reads when
+// total is null
+struct QueryOpTimer {
+    long long* total;
+    std::chrono::high_resolution_clock::time_point start;
+
+    explicit QueryOpTimer(long long* total_us) : total(total_us) {
+        if (total) start = std::chrono::high_resolution_clock::now();
+    }
+
+    ~QueryOpTimer() {
+        if (!total) return;
+        auto end = std::chrono::high_resolution_clock::now();
+        *total += std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    }
+};
+
+// Heap operations shared by the queries below, with the optional stats and
+// trace hooks applied in one place
+
+inline void queryInsert(QueryContext& ctx, int v, int key, QueryStats* stats, HeapTraceWriter* trace) {
+    {
+        QueryOpTimer timer(stats ? &stats->insert_time : nullptr);
+        ctx.ws.set_handle(v, ctx.pq.insert(key, v));
+    }
+    if (stats) {
+        stats->insert_count++;
+        stats->nodes_allocated++;
+    }
+    if (trace) trace->record_insert(ctx.ws.handle(v), key, v);
+}
+
+inline int queryExtract(QueryContext& ctx, QueryStats* stats, HeapTraceWriter* trace) {
+    HeapNode* min_node;
+    {
+        QueryOpTimer timer(stats ? &stats->extract_time : nullptr);
+        min_node = ctx.pq.extract_min();
+    }
+    int u = min_node->value;
+    if (trace) trace->record_extract(min_node);
+    delete min_node;
+    if (stats) stats->extract_count++;
+    return u;
+}
+
+// Queues a decrease for the next queryFlushDecreases
+inline void queryDecrease(QueryContext& ctx, int v, int key, HeapTraceWriter* trace) {
+    ctx.batch.push_back({ctx.ws.handle(v), key});
+    if (trace) trace->record_decrease(ctx.ws.handle(v), key);
+}
+
+inline void queryFlushDecreases(QueryContext& ctx, QueryStats* stats) {
+    if (ctx.batch.empty()) return;
+    {
+        QueryOpTimer timer(stats ? &stats->decrease_time : nullptr);
+        ctx.pq.decrease_keys(ctx.batch);
+    }
+    if (stats) stats->decrease_count += ctx.batch.size();
+}
+
+// Dijkstra from src; target = -1 settles the whole component. Vertices
+// enter the heap only when first reached; improvements to vertices already
+// in the heap are applied as one batch per settled vertex.
+template <typename GraphT>
+int shortestPath(const GraphT& g, int src, int target, QueryContext& ctx,
+                 QueryStats* stats = nullptr, HeapTraceWriter* trace = nullptr) {
+    QueryWorkspace<HeapNode*>& ws = ctx.ws;
+
+    ws.reset();
+    ws.set_dist(src, 0, -1);
+    queryInsert(ctx, src, 0, stats, trace);
+
+    while (!ctx.pq.empty()) {
+        int u = queryExtract(ctx, stats, trace);
+
+        ws.settle(u);
+        if (u == target) break;
+
+        int du = ws.dist(u);
+        ctx.batch.clear();
+        for (auto [v, w] : g.neighbors(u)) {
+            if (ws.settled(v) || du + w >= ws.dist(v)) continue;
+
+            bool inHeap = ws.seen(v);
+            ws.set_dist(v, du + w, u);
+            if (inHeap) queryDecrease(ctx, v, du + w, trace);
+            else queryInsert(ctx, v, du + w, stats, trace);
+        }
+        queryFlushDecreases(ctx, stats);
+    }
+
+    ctx.pq.clear();
+    return target < 0 ? 0 : ws.dist(target);
+}
+
+template <typename GraphT>
+void shortestPathTree(const GraphT& g, int src, QueryContext& ctx,
+                      QueryStats* stats = nullptr, HeapTraceWriter* trace = nullptr) {
+    shortestPath(g, src, -1, ctx, stats, trace);
+}
+
+// Prim from start over its component; tree edges are ctx.ws.parent(v)
+template <typename GraphT>
+long long mstWeight(const GraphT& g, int start, QueryContext& ctx,
+                    QueryStats* stats = nullptr, HeapTraceWriter* trace = nullptr) {
+    QueryWorkspace<HeapNode*>& ws = ctx.ws;
+
+    ws.reset();
+    ws.set_dist(start, 0, -1);
+    queryInsert(ctx, start, 0, stats, trace);
+
+    long long total = 0;
+    while (!ctx.pq.empty()) {
+        int u = queryExtract(ctx, stats, trace);
+
+        ws.settle(u);
+        total += ws.dist(u);
+
+        ctx.batch.clear();
+        for (auto [v, weight] : g.neighbors(u)) {
+            if (ws.settled(v) || weight >= ws.dist(v)) continue;
+
+            bool inHeap = ws.seen(v);
+            ws.set_dist(v, weight, u);
+            if (inHeap) queryDecrease(ctx, v, weight, trace);
+            else queryInsert(ctx, v, weight, stats, trace);
+        }
+        queryFlushDecreases(ctx, stats);
+    }
+
+    return total;
+}
+
+// Edge whose endpoints lie in different Voronoi cells
+struct BoundaryEdge {
+    int u, v, w;
+};
+
+struct VoronoiPartition {
+    ScratchVector<int> dist; // to the nearest source, INT_MAX if unreachable
+    ScratchVector<int> cell; // index into sources of the nearest source, -1 if unreachable
+    std::vector<BoundaryEdge> boundary; // each undirected edge once
+};
+
+// One Dijkstra seeded with every source at distance 0. A vertex belongs to
+// the cell of the source its shortest-path tree edge leads back to; on equal
+// distances, whichever source reached it first keeps it. Duplicate sources
+// keep their first index. onSettle(u) runs as each vertex is settled, after
+// which its dist and cell are final.
+template <typename GraphT, typename Sources, typename OnSettle>
+void multiSourceShortestPaths(const GraphT& g, const Sources& sources, QueryContext& ctx, OnSettle onSettle,
+                              QueryStats* stats = nullptr, HeapTraceWriter* trace = nullptr) {
+    QueryWorkspace<HeapNode*>& ws = ctx.ws;
+
+    ws.reset();
+    int index = 0;
+    for (int s : sources) {
+        if (!ws.seen(s)) {
+            ws.set_dist(s, 0, -1);
+            queryInsert(ctx, s, 0, stats, trace);
+            ctx.cellOf[s] = index;
+        }
+        index++;
+    }
+
+    while (!ctx.pq.empty()) {
+        int u = queryExtract(ctx, stats, trace);
+
+        ws.settle(u);
+        onSettle(u);
+
+        int du = ws.dist(u);
+        ctx.batch.clear();
+        for (auto [v, w] : g.neighbors(u)) {
+            if (ws.settled(v) || du + w >= ws.dist(v)) continue;
+
+            bool inHeap = ws.seen(v);
+            ws.set_dist(v, du + w, u);
+            ctx.cellOf[v] = ctx.cellOf[u];
+            if (inHeap) queryDecrease(ctx, v, du + w, trace);
+            else queryInsert(ctx, v, du + w, stats, trace);
+        }
+        queryFlushDecreases(ctx, stats);
+    }
+}
+
+template <typename GraphT, typename Sources>
+void multiSourceShortestPaths(const GraphT& g, const Sources& sources, QueryContext& ctx,
+                              QueryStats* stats = nullptr, HeapTraceWriter* trace = nullptr) {
+    multiSourceShortestPaths(g, sources, ctx, [](int) {}, stats, trace);
+}
+
+// Boundary edges are collected during the traversal: when u is settled,
+// every already-settled neighbor in another cell closes one boundary edge,
+// so each edge is reported exactly once, by its later-settled endpoint.
+template <typename GraphT, typename Sources>
+VoronoiPartition voronoiPartition(const GraphT& g, const Sources& sources, QueryContext& ctx,
+                                  QueryStats* stats = nullptr, HeapTraceWriter* trace = nullptr) {
+    VoronoiPartition p;
+    const QueryWorkspace<HeapNode*>& ws = ctx.ws;
+
+    multiSourceShortestPaths(g, sources, ctx, [&](int u) {
+        for (auto [v, w] : g.neighbors(u)) {
+            if (ws.settled(v) && ctx.cellOf[v] != ctx.cellOf[u]) {
+                p.boundary.push_back({v, u, w});
+            }
+        }
+    }, stats, trace);
+
+    p.dist.resize(g.V);
+    p.cell.resize(g.V);
+    for (int v = 0; v < g.V; v++) {
+        p.dist[v] = ws.dist(v);
+        p.cell[v] = ctx.cell(v);
+    }
+    return p;
+}
+
+#endif // GRAPH_QUERIES_HPP
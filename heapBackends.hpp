@@ -0,0 +1,117 @@
+/*
+ * HEAP BACKENDS
+ *
+ * Uniform adapters over the heap implementations, used by the trace replayer
+ * and the microbenchmark so the same operation stream can drive every heap.
+ *
+ * PUBLIC INTERFACE (every backend):
+ * ------------------------------------------------
+ * Backend::Handle h = heap.insert(key, value);
+ * int value = heap.extract_min();     // heap must not be empty
+ * heap.decrease_key(h, key);
+ * heap.meld(other);                   // other becomes empty
+ * bool e = heap.empty();
+ * heap.clear();                       // frees all nodes the backend owns
+ */
+
+#ifndef HEAP_BACKENDS_HPP
+#define HEAP_BACKENDS_HPP
+
+#include <vector>
+#include "Binomial_Heap.hpp"
+#include "pairingHeap.hpp"
+#include "Lazy_Binomial_Heap.hpp"
+#include "Hollow_Heap.hpp"
+
+struct PairingBackend {
+    typedef HeapNode* Handle;
+    PairingHeap pq;
+
+    Handle insert(int key, int value) { return pq.insert(key, value); }
+    int extract_min() {
+        HeapNode* n = pq.extract_min();
+        int value = n->value;
+        delete n;
+        return value;
+    }
+    void decrease_key(Handle h, int key) { pq.decrease_key(h, key); }
+    void meld(PairingBackend& other) { pq.join(other.pq); }
+    bool empty() { return pq.empty(); }
+    void clear() { pq.clear(); }
+};
+
+// Binomial_Heap keeps extracted nodes alive, and decrease_key moves
+// (key, vertexId) pairs up the tree, so a node pointer does not stay with
+// its item. Items get their own records: each node's vertexId is the index
+// of the item it holds, and decrease_key re-points the items it moved. The
+// backend owns every node and item it created.
+struct BinomialBackend {
+    struct Item {
+        Binomial_Heap_Node* node;
+        int value;
+    };
+    typedef Item* Handle;
+    Binomial_Heap pq;
+    std::vector<Item*> items; // by the index stored in vertexId
+
+    Handle insert(int key, int value) {
+        Item* item = new Item{nullptr, value};
+        item->node = pq.insert(key, (int)items.size());
+        items.push_back(item);
+        return item;
+    }
+    int extract_min() {
+        Item* item = items[pq.find_min()->vertexId];
+        pq.extract_min();
+        return item->value;
+    }
+    void decrease_key(Handle h, int key) {
+        Binomial_Heap_Node* n = h->node;
+        if (key >= n->key) return;
+        pq.decrease_key(n, key);
+        for (; n; n = n->parent) items[n->vertexId]->node = n;
+    }
+    void meld(BinomialBackend& other) {
+        for (Item* item : other.items) {
+            item->node->vertexId = (int)items.size();
+            items.push_back(item);
+        }
+        other.items.clear();
+        pq.merge(&other.pq);
+    }
+    bool empty() { return pq.empty(); }
+    void clear() {
+        for (Item* item : items) {
+            delete item->node;
+            delete item;
+        }
+        items.clear();
+        pq = Binomial_Heap();
+    }
+};
+
+struct LazyBinomialBackend {
+    typedef Lazy_Binomial_Item* Handle;
+    Lazy_Binomial_Heap pq;
+
+    Handle insert(int key, int value) { return pq.insert(key, value); }
+    int extract_min() { return pq.extract_min(); }
+    void decrease_key(Handle h, int key) { pq.decrease_key(h, key); }
+    void meld(LazyBinomialBackend& other) { pq.merge(&other.pq); }
+    bool empty() { return pq.empty(); }
+    void clear() { pq.clear(); }
+};
+
+struct HollowBackend {
+    typedef Hollow_Heap_Item* Handle;
+    Hollow_Heap pq;
+
+    Handle insert(int key, int value) { return pq.insert(key, value); }
+    int extract_min() { return pq.extract_min(); }
+    void decrease_key(Handle h, int key) { pq.decrease_key(h, key); }
+    void meld(HollowBackend& other) { pq.merge(&other.pq); }
+    bool empty() { return pq.empty(); }
+    void clear() { pq.clear(); }
+};
+
+#endif // HEAP_BACKENDS_HPP
@@ -0,0 +1,456 @@
+/*
+ * HEAP MICROBENCHMARK
+ * Times single heap operations and synthetic operation mixes on every heap
+ * backend (heapBackends.hpp), with no graph work in the loop, across heap
+ * sizes from L1-resident to DRAM-resident.
+ *
+ * Usage: heapBench [pairing|binomial|lazy|hollow|all] [max_log2_size] [samples] [filter]
+ *   Sizes are 2^8, 2^11, ... up to max_log2_size; the default goes one step
+ *   past the detected L3 size. filter keeps only workloads whose name
+ *   contains it, e.g. "decrease".
+ *
+ * Every workload is an operation stream generated up front against a
+ * reference model (so the timed loop does no bookkeeping): an untimed setup
+ * part that builds the heap(s) and a measured part. One sample replays the
+ * stream until at least MIN_SAMPLE_OPS measured operations have run and
+ * reports measured ns / measured ops. Output is the mean over the samples
+ * with a 95% confidence interval (Student t), plus the fastest sample.
+ *
+ * The heaps' own per-op timers are compiled out (NO_HEAP_OP_TIMING). Memory
+ * tracking stays on, since it is part of what insert costs in the drivers;
+ * build with -DNO_MEMORY_TRACKING to time the heaps without it.
+ */
+
+#define NO_HEAP_OP_TIMING
+#include <bits/stdc++.h>
+#include <unistd.h>
+#include "heapBackends.hpp"
+#include "memoryTracker.hpp"
+
+using namespace std;
+
+const long long MIN_SAMPLE_OPS = 1 << 18;
+// A (backend, workload) pair slower than this is not run at larger sizes:
+// it is superlinear there and a single round could take hours
+const double SKIP_NS_PER_OP = 5000;
+
+/* =======================
+   WORKLOADS
+   ======================= */
+
+enum BenchOpType : uint8_t {
+    OP_INSERT,
+    OP_EXTRACT,
+    OP_DECREASE,
+    OP_MELD
+};
+
+struct BenchOp {
+    uint8_t op;
+    int key;          // INSERT, DECREASE
+    uint32_t handle;  // INSERT: handle created, DECREASE: handle changed
+    uint32_t heap;    // heap the op applies to
+    uint32_t other;   // MELD: heap melded into `heap`
+};
+
+struct Workload {
+    string name;
+    uint32_t heaps = 1;
+    uint32_t handles = 0;
+    vector<BenchOp> setup;
+    vector<BenchOp> measured;
+};
+
+enum KeyOrder { KEYS_RANDOM, KEYS_SORTED, KEYS_REVERSE };
+
+// Tracks live handles and their keys so the generated stream only decreases
+// live handles to smaller keys, and knows the current minimum
+struct ReferenceHeap {
+    typedef pair<int, uint32_t> Entry;
+    vector<int> key;
+    vector<uint32_t> live;     // live handles, for uniform random picks
+    vector<uint32_t> livePos;  // handle -> index in live
+    priority_queue<Entry, vector<Entry>, greater<Entry>> byKey; // lazy deletion
+
+    uint32_t insert(int k) {
+        uint32_t h = key.size();
+        key.push_back(k);
+        livePos.push_back(live.size());
+        live.push_back(h);
+        byKey.push({k, h});
+        return h;
+    }
+
+    int min_key() {
+        settleTop();
+        return byKey.top().first;
+    }
+
+    void extract_min() {
+        settleTop();
+        uint32_t h = byKey.top().second;
+        byKey.pop();
+        uint32_t last = live.back();
+        live[livePos[h]] = last;
+        livePos[last] = livePos[h];
+        live.pop_back();
+        livePos[h] = UINT32_MAX;
+    }
+
+    void decrease(uint32_t h, int k) {
+        key[h] = k;
+        byKey.push({k, h});
+    }
+
+    bool empty() const { return live.empty(); }
+
+private:
+    void settleTop() {
+        while (livePos[byKey.top().second] == UINT32_MAX || byKey.top().first != key[byKey.top().second]) {
+            byKey.pop();
+        }
+    }
+};
+
+struct WorkloadBuilder {
+    Workload w;
+    ReferenceHeap ref;
+    mt19937_64 rng;
+    int sortedNext = 0;
+    int reverseNext = INT_MAX / 2;
+
+    WorkloadBuilder(const string& name, uint64_t seed) : rng(seed) { w.name = name; }
+
+    int nextKey(KeyOrder order) {
+        if (order == KEYS_SORTED) return sortedNext++;
+        if (order == KEYS_REVERSE) return reverseNext--;
+        return (int)(rng() % (1u << 30));
+    }
+
+    void insert(vector<BenchOp>& out, KeyOrder order) {
+        int k = nextKey(order);
+        out.push_back({OP_INSERT, k, ref.insert(k), 0, 0});
+    }
+
+    void extract(vector<BenchOp>& out) {
+        ref.extract_min();
+        out.push_back({OP_EXTRACT, 0, 0, 0, 0});
+    }
+
+    // Dijkstra-like: new key uniform in [min, key)
+    void decreaseRandom(vector<BenchOp>& out) {
+        uint32_t h = ref.live[rng() % ref.live.size()];
+        int lo = ref.min_key(), hi = ref.key[h];
+        int k = hi > lo ? lo + (int)(rng() % (uint64_t)(hi - lo)) : hi;
+        ref.decrease(h, k);
+        out.push_back({OP_DECREASE, k, h, 0, 0});
+    }
+
+    // Every decrease produces a new minimum
+    void decreaseToMin(vector<BenchOp>& out) {
+        uint32_t h = ref.live[rng() % ref.live.size()];
+        int k = ref.min_key() - 1;
+        ref.decrease(h, k);
+        out.push_back({OP_DECREASE, k, h, 0, 0});
+    }
+
+    Workload finish() {
+        w.handles = ref.key.size();
+        return move(w);
+    }
+};
+
+Workload insertWorkload(const string& name, int n, KeyOrder order, uint64_t seed) {
+    WorkloadBuilder b(name, seed);
+    for (int i = 0; i < n; i++) b.insert(b.w.measured, order);
+    return b.finish();
+}
+
+Workload extractWorkload(const string& name, int n, KeyOrder order, uint64_t seed) {
+    WorkloadBuilder b(name, seed);
+    for (int i = 0; i < n; i++) b.insert(b.w.setup, order);
+    for (int i = 0; i < n; i++) b.extract(b.w.measured);
+    return b.finish();
+}
+
+// Setup ends with one extract_min so the decreases hit a consolidated heap
+// rather than a freshly inserted one
+Workload decreaseWorkload(const string& name, int n, bool adversarial, uint64_t seed) {
+    WorkloadBuilder b(name, seed);
+    for (int i = 0; i < n + 1; i++) b.insert(b.w.setup, KEYS_RANDOM);
+    b.extract(b.w.setup);
+    for (int i = 0; i < n; i++) {
+        if (adversarial) b.decreaseToMin(b.w.measured);
+        else b.decreaseRandom(b.w.measured);
+    }
+    return b.finish();
+}
+
+// n/8 heaps of 8 elements melded pairwise until one heap is left
+Workload meldWorkload(const string& name, int n, uint64_t seed) {
+    WorkloadBuilder b(name, seed);
+    uint32_t heaps = max(2, n / 8);
+    b.w.heaps = heaps;
+    for (int i = 0; i < n; i++) {
+        int k = b.nextKey(KEYS_RANDOM);
+        b.w.setup.push_back({OP_INSERT, k, (uint32_t)i, (uint32_t)(i % heaps), 0});
+    }
+    for (uint32_t stride = 1; stride < heaps; stride *= 2) {
+        for (uint32_t h = 0; h + stride < heaps; h += 2 * stride) {
+            b.w.measured.push_back({OP_MELD, 0, 0, h, h + stride});
+        }
+    }
+    b.w.handles = n;
+    return move(b.w);
+}
+
+// Single heap at steady state around n elements: setup fills it, then 2n
+// ops drawn with the given percentages (the rest are extracts)
+Workload mixWorkload(const string& name, int n, int insertPct, int decreasePct, uint64_t seed) {
+    WorkloadBuilder b(name, seed);
+    for (int i = 0; i < n + 1; i++) b.insert(b.w.setup, KEYS_RANDOM);
+    b.extract(b.w.setup);
+    for (int i = 0; i < 2 * n; i++) {
+        int r = b.rng() % 100;
+        if (r < insertPct || b.ref.empty()) b.insert(b.w.measured, KEYS_RANDOM);
+        else if (r < insertPct + decreasePct) b.decreaseRandom(b.w.measured);
+        else b.extract(b.w.measured);
+    }
+    return b.finish();
+}
+
+// 16 heaps; inserts and extracts hit a random heap, melds join two random
+// heaps (the source is left empty and refilled by later inserts)
+Workload meldMixWorkload(const string& name, int n, uint64_t seed) {
+    const uint32_t heaps = 16;
+    WorkloadBuilder b(name, seed);
+    b.w.heaps = heaps;
+    vector<long long> sizes(heaps, 0);
+    uint32_t handle = 0;
+    auto insertInto = [&](vector<BenchOp>& out, uint32_t h) {
+        out.push_back({OP_INSERT, b.nextKey(KEYS_RANDOM), handle++, h, 0});
+        sizes[h]++;
+    };
+
+    for (int i = 0; i < n; i++) insertInto(b.w.setup, i % heaps);
+    for (int i = 0; i < 2 * n; i++) {
+        int r = b.rng() % 100;
+        uint32_t h = b.rng() % heaps;
+        long long total = accumulate(sizes.begin(), sizes.end(), 0LL);
+        if (r < 40 || total == 0) {
+            insertInto(b.w.measured, h);
+        } else if (r < 60) {
+            uint32_t other = b.rng() % heaps;
+            if (other == h) other = (other + 1) % heaps;
+            b.w.measured.push_back({OP_MELD, 0, 0, h, other});
+            sizes[h] += sizes[other];
+            sizes[other] = 0;
+        } else {
+            while (sizes[h] == 0) h = (h + 1) % heaps;
+            b.w.measured.push_back({OP_EXTRACT, 0, 0, h, 0});
+            sizes[h]--;
+        }
+    }
+    b.w.handles = handle;
+    return move(b.w);
+}
+
+vector<Workload> makeWorkloads(int n, const string& filter) {
+    vector<Workload> all;
+    auto add = [&](const string& name, auto make) {
+        if (filter.empty() || name.find(filter) != string::npos) all.push_back(make(name));
+    };
+    uint64_t seed = 12345 + n;
+
+    add("insert/random",        [&](const string& s) { return insertWorkload(s, n, KEYS_RANDOM, seed); });
+    add("insert/sorted",        [&](const string& s) { return insertWorkload(s, n, KEYS_SORTED, seed); });
+    add("insert/reverse",       [&](const string& s) { return insertWorkload(s, n, KEYS_REVERSE, seed); });
+    add("extract_min/random",   [&](const string& s) { return extractWorkload(s, n, KEYS_RANDOM, seed); });
+    add("extract_min/sorted",   [&](const string& s) { return extractWorkload(s, n, KEYS_SORTED, seed); });
+    add("decrease_key/random",  [&](const string& s) { return decreaseWorkload(s, n, false, seed); });
+    add("decrease_key/to-min",  [&](const string& s) { return decreaseWorkload(s, n, true, seed); });
+    add("meld/pairwise",        [&](const string& s) { return meldWorkload(s, n, seed); });
+    add("mix/insert-heavy",     [&](const string& s) { return mixWorkload(s, n, 60, 10, seed); });
+    add("mix/decrease-heavy",   [&](const string& s) { return mixWorkload(s, n, 15, 70, seed); });
+    add("mix/meld-heavy",       [&](const string& s) { return meldMixWorkload(s, n, seed); });
+    return all;
+}
+
+/* =======================
+   REPLAY
+   ======================= */
+
+template <typename Backend>
+inline long long apply(const vector<BenchOp>& ops, Backend* heaps, vector<typename Backend::Handle>& handles) {
+    long long checksum = 0;
+    for (const BenchOp& op : ops) {
+        switch (op.op) {
+            case OP_INSERT:
+                handles[op.handle] = heaps[op.heap].insert(op.key, (int)op.handle);
+                break;
+            case OP_EXTRACT:
+                checksum += heaps[op.heap].extract_min();
+                break;
+            case OP_DECREASE:
+                heaps[op.heap].decrease_key(handles[op.handle], op.key);
+                break;
+            case OP_MELD:
+                heaps[op.heap].meld(heaps[op.other]);
+                break;
+        }
+    }
+    return checksum;
+}
+
+struct RoundResult {
+    long long ns;
+    long long checksum;
+    long long node_bytes; // heap node + scratch peak during the round
+};
+
+template <typename Backend>
+RoundResult runRound(const Workload& w) {
+    vector<typename Backend::Handle> handles(w.handles);
+    unique_ptr<Backend[]> heaps(new Backend[w.heaps]);
+    memResetPeaks();
+    long long baseline = memCounters[MEM_HEAP_NODES].current.load() + memCounters[MEM_HEAP_SCRATCH].current.load();
+
+    long long checksum = apply(w.setup, heaps.get(), handles);
+    auto start = chrono::steady_clock::now();
+    checksum += apply(w.measured, heaps.get(), handles);
+    auto end = chrono::steady_clock::now();
+
+    long long peak = memCounters[MEM_HEAP_NODES].peak.load() + memCounters[MEM_HEAP_SCRATCH].peak.load() - baseline;
+    for (uint32_t h = 0; h < w.heaps; h++) heaps[h].clear();
+    return {chrono::duration_cast<chrono::nanoseconds>(end - start).count(), checksum, peak};
+}
+
+/* =======================
+   STATISTICS
+   ======================= */
+
+// Two-sided 95% Student t quantiles for 1..30 degrees of freedom
+double tQuantile95(int df) {
+    static const double table[] = {
+        12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+        2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+        2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+    if (df < 1) return 0;
+    return df <= 30 ? table[df - 1] : 1.960;
+}
+
+struct Summary {
+    double mean, half_width, best;
+};
+
+Summary summarize(const vector<double>& samples) {
+    int n = samples.size();
+    double mean = accumulate(samples.begin(), samples.end(), 0.0) / n;
+    double var = 0;
+    for (double s : samples) var += (s - mean) * (s - mean);
+    var = n > 1 ? var / (n - 1) : 0;
+    return {mean, tQuantile95(n - 1) * sqrt(var / n), *min_element(samples.begin(), samples.end())};
+}
+
+/* =======================
+   CACHE TIERS
+   ======================= */
+
+struct CacheSizes {
+    long l1, l2, l3;
+};
+
+CacheSizes detectCaches() {
+    CacheSizes c = {sysconf(_SC_LEVEL1_DCACHE_SIZE), sysconf(_SC_LEVEL2_CACHE_SIZE), sysconf(_SC_LEVEL3_CACHE_SIZE)};
+    if (c.l1 <= 0) c.l1 = 32 << 10;
+    if (c.l2 <= 0) c.l2 = 1 << 20;
+    if (c.l3 <= 0) c.l3 = 32 << 20;
+    return c;
+}
+
+const char* tierOf(long long bytes, const CacheSizes& c) {
+    if (bytes <= 0) return "?"; // NO_MEMORY_TRACKING
+    if (bytes <= c.l1) return "L1";
+    if (bytes <= c.l2) return "L2";
+    if (bytes <= c.l3) return "L3";
+    return "DRAM";
+}
+
+/* =======================
+   MAIN
+   ======================= */
+
+// Returns the mean ns/op
+template <typename Backend>
+double bench(const string& backend, const Workload& w, int samples, const CacheSizes& caches) {
+    long long measuredOps = w.measured.size();
+    if (measuredOps == 0) return 0;
+    int rounds = (int)max(1LL, (MIN_SAMPLE_OPS + measuredOps - 1) / measuredOps);
+
+    runRound<Backend>(w); // warm-up: page in the allocator arenas
+    vector<double> nsPerOp;
+    long long checksum = 0, footprint = 0;
+    for (int s = 0; s < samples; s++) {
+        long long ns = 0;
+        for (int r = 0; r < rounds; r++) {
+            RoundResult res = runRound<Backend>(w);
+            ns += res.ns;
+            checksum += res.checksum;
+            footprint = res.node_bytes;
+        }
+        nsPerOp.push_back(ns / (double)(measuredOps * rounds));
+    }
+
+    Summary sum = summarize(nsPerOp);
+    cout << "  " << setw(9) << left << backend << setw(22) << w.name << right
+         << setw(9) << footprint / 1024 << " KB " << setw(5) << tierOf(footprint, caches)
+         << fixed << setprecision(2)
+         << setw(10) << sum.mean << " ns/op +- " << setw(6) << sum.half_width
+         << " (min " << setw(7) << sum.best << ")"
+         << "  [" << (checksum & 0xffff) << "]\n";
+    cout.unsetf(ios::fixed);
+    return sum.mean;
+}
+
+// Runs one backend unless it was pathologically slow at a smaller size
+template <typename Backend>
+void benchOrSkip(const string& backend, const Workload& w, int samples, const CacheSizes& caches,
+                 map<string, double>& lastMean) {
+    string key = backend + " " + w.name;
+    auto it = lastMean.find(key);
+    if (it != lastMean.end() && it->second > SKIP_NS_PER_OP) {
+        cout << "  " << setw(9) << left << backend << setw(22) << w.name << right
+             << "  skipped: " << (long long)it->second << " ns/op at a smaller size\n";
+        return;
+    }
+    lastMean[key] = bench<Backend>(backend, w, samples, caches);
+}
+
+int main(int argc, char** argv) {
+    string backend = argc > 1 ? argv[1] : "all";
+    int samples = argc > 3 ? max(2, stoi(argv[3])) : 7;
+    string filter = argc > 4 ? argv[4] : "";
+
+    CacheSizes caches = detectCaches();
+    int maxLog2 = 8;
+    while ((48LL << maxLog2) <= caches.l3) maxLog2 += 3; // ~48 bytes per node
+    if (argc > 2) maxLog2 = stoi(argv[2]);
+
+    cout << "Caches: L1d " << caches.l1 / 1024 << " KB, L2 " << caches.l2 / 1024
+         << " KB, L3 " << caches.l3 / 1024 << " KB | " << samples << " samples of >= "
+         << MIN_SAMPLE_OPS << " ops, mean +- 95% CI\n";
+    cout << "  backend  workload                heap memory tier\n";
+
+    map<string, double> lastMean;
+    for (int lg = 8; lg <= maxLog2; lg += 3) {
+        int n = 1 << lg;
+        cout << "\nn = " << n << "\n";
+        for (const Workload& w : makeWorkloads(n, filter)) {
+            if (backend == "pairing" || backend == "all") benchOrSkip<PairingBackend>("pairing", w, samples, caches, lastMean);
+            if (backend == "binomial" || backend == "all") benchOrSkip<BinomialBackend>("binomial", w, samples, caches, lastMean);
+            if (backend == "lazy" || backend == "all") benchOrSkip<LazyBinomialBackend>("lazy", w, samples, caches, lastMean);
+            if (backend == "hollow" || backend == "all") benchOrSkip<HollowBackend>("hollow", w, samples, caches, lastMean);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,195 @@
+/*
+ * HEAP TRACE REPLAY
+ * Replays a recorded heap operation trace (see heapTrace.hpp) against each
+ * heap backend with no graph work in the loop, so only heap cost is timed.
+ *
+ * Backends break key ties differently, so before timing the trace is made
+ * replayable on all of them: keys are replaced by their rank under (key,
+ * recorded extraction order, handle), which breaks ties the way the
+ * recording heap did, and a reference heap drops decreases of items that
+ * are already gone. Every backend then removes the same items in the same
+ * order; each extract is checked against it.
+ *
+ * Usage: heapReplay <trace.htrc> [backend|all] [reps]
+ *   Exits with 1 if any backend extracts a different item.
+ *
+ * The heaps' own per-op timers are compiled out (NO_HEAP_OP_TIMING), so
+ * their clock reads do not count against the backends that have them.
+ *
+ * Adding a backend: write an adapter in heapBackends.hpp and add a line to
+ * main().
+ */
+
+#define NO_HEAP_OP_TIMING
+#include <bits/stdc++.h>
+#include "heapBackends.hpp"
+#include "heapTrace.hpp"
+#include "memoryTracker.hpp"
+
+using namespace std;
+
+/* =======================
+   PREPARE
+   ======================= */
+
+struct PreparedTrace {
+    vector<TraceOp> ops;    // keys ranked, EXTRACT value = item expected
+    size_t inserts = 0;
+    long long dropped = 0;  // decreases of removed items, extracts of an empty heap
+    long long reordered = 0; // extracts that differ from the recording
+};
+
+PreparedTrace prepareTrace(const vector<TraceOp>& recorded) {
+    PreparedTrace p;
+    vector<uint32_t> extractedAt; // handle -> index of its recorded extract
+    for (const TraceOp& op : recorded) {
+        if (op.op == TRACE_INSERT) {
+            extractedAt.push_back(UINT32_MAX);
+            p.inserts++;
+        }
+    }
+    uint32_t extracts = 0;
+    for (const TraceOp& op : recorded) {
+        if (op.op != TRACE_EXTRACT) continue;
+        if (extractedAt[op.handle] == UINT32_MAX) extractedAt[op.handle] = extracts;
+        extracts++;
+    }
+
+    typedef tuple<int, uint32_t, uint32_t> Order; // key, extracted at, handle
+    vector<Order> orders;
+    for (const TraceOp& op : recorded) {
+        if (op.op != TRACE_EXTRACT) orders.emplace_back(op.key, extractedAt[op.handle], op.handle);
+    }
+    sort(orders.begin(), orders.end());
+    auto rankOf = [&](const TraceOp& op) {
+        Order o(op.key, extractedAt[op.handle], op.handle);
+        return (int)(lower_bound(orders.begin(), orders.end(), o) - orders.begin());
+    };
+
+    vector<int> rank(p.inserts, -1), value(p.inserts); // rank -1 = not in the heap
+    set<pair<int, uint32_t>> heap;
+    for (const TraceOp& op : recorded) {
+        TraceOp out = op;
+        if (op.op == TRACE_INSERT) {
+            out.key = rankOf(op);
+            rank[op.handle] = out.key;
+            value[op.handle] = op.value;
+            heap.insert({out.key, op.handle});
+        } else if (op.op == TRACE_DECREASE) {
+            out.key = rankOf(op);
+            if (rank[op.handle] < 0 || out.key >= rank[op.handle]) {
+                p.dropped++;
+                continue;
+            }
+            heap.erase({rank[op.handle], op.handle});
+            heap.insert({out.key, op.handle});
+            rank[op.handle] = out.key;
+        } else {
+            if (heap.empty()) {
+                p.dropped++;
+                continue;
+            }
+            out.handle = heap.begin()->second;
+            out.value = value[out.handle];
+            heap.erase(heap.begin());
+            rank[out.handle] = -1;
+            if (out.handle != op.handle) p.reordered++;
+        }
+        p.ops.push_back(out);
+    }
+    return p;
+}
+
+/* =======================
+   REPLAY
+   ======================= */
+
+struct ReplayResult {
+    long long ns;
+    long long checksum;    // sum of extract_min results, keeps the work observable
+    long long peak_bytes;  // heap node + heap scratch peak above the pre-run level
+    long long mismatches;  // extracts that returned another item than expected
+};
+
+template <typename Backend>
+ReplayResult replay_once(const vector<TraceOp>& ops, size_t inserts) {
+    vector<typename Backend::Handle> handles(inserts);
+    memResetPeaks();
+    long long baseline = memCounters[MEM_HEAP_NODES].current.load() + memCounters[MEM_HEAP_SCRATCH].current.load();
+
+    auto start = chrono::steady_clock::now();
+    long long checksum = 0, mismatches = 0;
+    {
+        Backend heap;
+        for (const TraceOp& op : ops) {
+            switch (op.op) {
+                case TRACE_INSERT:
+                    handles[op.handle] = heap.insert(op.key, op.value);
+                    break;
+                case TRACE_EXTRACT: {
+                    int value = heap.extract_min();
+                    checksum += value;
+                    mismatches += value != op.value;
+                    break;
+                }
+                case TRACE_DECREASE:
+                    heap.decrease_key(handles[op.handle], op.key);
+                    break;
+            }
+        }
+        heap.clear();
+    }
+    auto end = chrono::steady_clock::now();
+
+    long long peak = memCounters[MEM_HEAP_NODES].peak.load() + memCounters[MEM_HEAP_SCRATCH].peak.load() - baseline;
+    return {chrono::duration_cast<chrono::nanoseconds>(end - start).count(), checksum, peak, mismatches};
+}
+
+// Returns false if the backend extracted items out of order
+template <typename Backend>
+bool replay(const string& name, const vector<TraceOp>& ops, size_t inserts, int reps) {
+    vector<long long> times;
+    ReplayResult r = {0, 0, 0, 0};
+    for (int i = 0; i < reps; i++) {
+        r = replay_once<Backend>(ops, inserts);
+        times.push_back(r.ns);
+    }
+    sort(times.begin(), times.end());
+
+    cout << "  " << setw(10) << left << name << right
+         << " min " << setw(10) << times.front() / 1000 << " us"
+         << " | median " << setw(10) << times[times.size() / 2] / 1000 << " us"
+         << " | " << fixed << setprecision(1) << times[times.size() / 2] / (double)ops.size() << " ns/op"
+         << " | peak heap mem " << r.peak_bytes / 1024 << " KB"
+         << " | checksum " << r.checksum
+         << (r.mismatches ? " | MISMATCH (" + to_string(r.mismatches) + " extracts)" : "") << "\n";
+    return r.mismatches == 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        cerr << "usage: " << argv[0] << " <trace.htrc> [pairing|binomial|lazy|hollow|all] [reps]\n";
+        return 1;
+    }
+    string backend = argc > 2 ? argv[2] : "all";
+    int reps = argc > 3 ? stoi(argv[3]) : 5;
+
+    vector<TraceOp> ops = readHeapTrace(argv[1]);
+    size_t counts[3] = {0, 0, 0};
+    for (const TraceOp& op : ops) counts[op.op]++;
+    PreparedTrace trace = prepareTrace(ops);
+
+    cout << "Trace: " << argv[1] << "\n";
+    cout << "  Insert: " << counts[TRACE_INSERT]
+         << " | Extract-min: " << counts[TRACE_EXTRACT]
+         << " | Decrease-key: " << counts[TRACE_DECREASE] << "\n";
+    cout << "  Replay drops " << trace.dropped << " ops on removed items; "
+         << trace.reordered << " extracts differ from the recording\n";
+
+    bool ok = true;
+    if (backend == "pairing" || backend == "all") ok &= replay<PairingBackend>("pairing", trace.ops, trace.inserts, reps);
+    if (backend == "binomial" || backend == "all") ok &= replay<BinomialBackend>("binomial", trace.ops, trace.inserts, reps);
+    if (backend == "lazy" || backend == "all") ok &= replay<LazyBinomialBackend>("lazy", trace.ops, trace.inserts, reps);
+    if (backend == "hollow" || backend == "all") ok &= replay<HollowBackend>("hollow", trace.ops, trace.inserts, reps);
+    return ok ? 0 : 1;
+}
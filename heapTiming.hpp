@@ -0,0 +1,47 @@
+/*
+ * HEAP OP TIMING
+ *
+ * Scoped timer behind the heaps' extract_min_time / decrease_key_time
+ * counters: adds the microseconds spent in its scope to a total when it goes
+ * out of scope, so early returns are timed too.
+ *
+ * PUBLIC INTERFACE:
+ * ------------------------------------------------
+ * HeapOpTimer timer(extract_min_time);   // first line of the operation
+ *
+ * Define NO_HEAP_OP_TIMING to compile the timers out; two clock reads per
+ * operation would otherwise dominate per-op microbenchmarks.
+ */
+
+#ifndef HEAP_TIMING_HPP
+#define HEAP_TIMING_HPP
+
+#include <chrono>
+
+#ifndef NO_HEAP_OP_TIMING
+
+struct HeapOpTimer {
+    std::chrono::high_resolution_clock::time_point start;
+    long long& total; // microseconds
+
+    explicit HeapOpTimer(long long& total_us)
+        : start(std::chrono::high_resolution_clock::now()), total(total_us) {}
+
+    ~HeapOpTimer() {
+        auto end = std::chrono::high_resolution_clock::now();
+        total += std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    }
+
+    HeapOpTimer(const HeapOpTimer&) = delete;
+    HeapOpTimer& operator=(const HeapOpTimer&) = delete;
+};
+
+#else
+
+struct HeapOpTimer {
+    explicit HeapOpTimer(long long&) {}
+};
+
+#endif
+
+#endif // HEAP_TIMING_HPP
@@ -0,0 +1,182 @@
+/*
+ * HEAP OPERATION TRACES
+ *
+ * Records the exact insert / extract_min / decrease_key sequence a driver
+ * issues so it can be replayed against any heap backend in isolation
+ * (see heapReplay.cpp).
+ *
+ * File format (little endian):
+ *   "HTRC" magic, uint32 version
+ *   one record per operation:
+ *     0x00 INSERT    zigzag-varint key, varint value
+ *     0x01 EXTRACT   varint handle removed
+ *     0x02 DECREASE  varint handle, zigzag-varint new key
+ * Handles are implicit: the i-th INSERT creates handle i. EXTRACT names the
+ * item the recording heap removed, since heaps may break key ties
+ * differently.
+ *
+ * PUBLIC INTERFACE:
+ * ------------------------------------------------
+ * HeapTraceWriter trace("run.htrc");
+ * trace.record_insert(node, key, value);   // node = pointer returned by insert
+ * trace.record_extract(node);            // node extract_min removed
+ * trace.record_decrease(node, new_key);
+ * vector<TraceOp> ops = readHeapTrace("run.htrc");
+ */
+
+#ifndef HEAP_TRACE_HPP
+#define HEAP_TRACE_HPP
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <cstdint>
+#include <cstring>
+
+enum TraceOpCode : uint8_t {
+    TRACE_INSERT = 0,
+    TRACE_EXTRACT = 1,
+    TRACE_DECREASE = 2
+};
+
+struct TraceOp {
+    uint8_t op;
+    int key;       // INSERT, DECREASE
+    int value;     // INSERT, EXTRACT: vertex id
+    uint32_t handle; // INSERT: handle created, EXTRACT: handle removed,
+                     // DECREASE: handle changed
+};
+
+static const char HEAP_TRACE_MAGIC[4] = {'H', 'T', 'R', 'C'};
+static const uint32_t HEAP_TRACE_VERSION = 2;
+
+struct HeapTraceWriter {
+    std::ofstream out;
+    std::vector<uint8_t> buffer;
+    std::unordered_map<const void*, uint32_t> handleOf; // live node -> handle id
+    uint32_t next_handle = 0;
+
+    // Performance tracking
+    long long op_count = 0;
+    long long bytes_written = 0;
+
+    HeapTraceWriter(const std::string& path) : out(path, std::ios::binary) {
+        if (!out) throw std::runtime_error("cannot open trace file " + path);
+        out.write(HEAP_TRACE_MAGIC, 4);
+        out.write(reinterpret_cast<const char*>(&HEAP_TRACE_VERSION), 4);
+        bytes_written = 8;
+        buffer.reserve(1 << 16);
+    }
+
+    ~HeapTraceWriter() { flush(); }
+
+    void record_insert(const void* node, int key, int value) {
+        handleOf[node] = next_handle++;
+        buffer.push_back(TRACE_INSERT);
+        put_varint(zigzag(key));
+        put_varint((uint32_t)value);
+        end_record();
+    }
+
+    void record_extract(const void* node) {
+        buffer.push_back(TRACE_EXTRACT);
+        put_varint(handle(node));
+        end_record();
+    }
+
+    void record_decrease(const void* node, int new_key) {
+        buffer.push_back(TRACE_DECREASE);
+        put_varint(handle(node));
+        put_varint(zigzag(new_key));
+        end_record();
+    }
+
+    void flush() {
+        if (buffer.empty()) return;
+        out.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+        bytes_written += buffer.size();
+        buffer.clear();
+        out.flush();
+    }
+
+private:
+    uint32_t handle(const void* node) const {
+        auto it = handleOf.find(node);
+        if (it == handleOf.end()) throw std::runtime_error("heap operation on untraced node");
+        return it->second;
+    }
+
+    static uint32_t zigzag(int x) { return ((uint32_t)x << 1) ^ (uint32_t)(x >> 31); }
+
+    void put_varint(uint32_t x) {
+        while (x >= 0x80) {
+            buffer.push_back((uint8_t)(x | 0x80));
+            x >>= 7;
+        }
+        buffer.push_back((uint8_t)x);
+    }
+
+    void end_record() {
+        op_count++;
+        if (buffer.size() >= (1 << 16)) flush();
+    }
+};
+
+// Decodes a whole trace into memory so replay timing excludes parsing
+inline std::vector<TraceOp> readHeapTrace(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) throw std::runtime_error("cannot open trace file " + path);
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    if (data.size() < 8 || std::memcmp(data.data(), HEAP_TRACE_MAGIC, 4) != 0) {
+        throw std::runtime_error("not a heap trace: " + path);
+    }
+    uint32_t version;
+    std::memcpy(&version, data.data() + 4, 4);
+    if (version != HEAP_TRACE_VERSION) throw std::runtime_error("unsupported trace version");
+
+    size_t pos = 8;
+    auto get_varint = [&]() {
+        uint32_t x = 0;
+        int shift = 0;
+        while (true) {
+            if (pos >= data.size()) throw std::runtime_error("truncated trace");
+            uint8_t b = data[pos++];
+            x |= (uint32_t)(b & 0x7f) << shift;
+            if (!(b & 0x80)) return x;
+            shift += 7;
+        }
+    };
+    auto unzigzag = [](uint32_t x) { return (int)(x >> 1) ^ -(int)(x & 1); };
+
+    std::vector<TraceOp> ops;
+    std::vector<int> valueOf; // handle -> value
+    auto get_handle = [&]() {
+        uint32_t h = get_varint();
+        if (h >= valueOf.size()) throw std::runtime_error("corrupt trace: unknown handle");
+        return h;
+    };
+    while (pos < data.size()) {
+        TraceOp op = {data[pos++], 0, 0, 0};
+        if (op.op == TRACE_INSERT) {
+            op.key = unzigzag(get_varint());
+            op.value = (int)get_varint();
+            op.handle = valueOf.size();
+            valueOf.push_back(op.value);
+        } else if (op.op == TRACE_EXTRACT) {
+            op.handle = get_handle();
+            op.value = valueOf[op.handle];
+        } else if (op.op == TRACE_DECREASE) {
+            op.handle = get_handle();
+            op.key = unzigzag(get_varint());
+        } else {
+            throw std::runtime_error("corrupt trace record");
+        }
+        ops.push_back(op);
+    }
+    return ops;
+}
+
+#endif // HEAP_TRACE_HPP
@@ -0,0 +1,110 @@
+/*
+ * INTERLEAVED QUERY BENCHMARK
+ * Answers the same random point-to-point queries with InterleavedQueries at
+ * 1, 2, 4, ... slots and reports per-thread throughput against 1 slot (the
+ * queries back to back). Every thread owns its own engine and a disjoint
+ * share of the queries.
+ *
+ * Usage: interleavedQueries [n] [m] [queries] [threads] [max_slots] [hops] [seed]
+ *   hops  0 = uniform random targets (each query settles about half the
+ *         graph); k > 0 = target at the end of a k-step random walk
+ */
+
+#include <bits/stdc++.h>
+#include "graphGenerator.hpp"
+#include "graphQueries.hpp"
+#include "interleavedQueries.hpp"
+
+using namespace std;
+
+const int CHECK_QUERIES = 4; // also answered by the pairing-heap shortestPath
+
+double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+// Runs fn(thread, begin, end) over an even split of [0, total) and returns
+// the slowest thread's wall time in seconds
+template <typename Fn>
+double timeThreads(int threads, size_t total, Fn fn) {
+    vector<double> seconds(threads);
+    vector<thread> pool;
+    for (int t = 0; t < threads; t++) {
+        pool.emplace_back([&, t]() {
+            size_t begin = total * t / threads, end = total * (t + 1) / threads;
+            auto start = chrono::steady_clock::now();
+            fn(t, begin, end);
+            seconds[t] = secondsSince(start);
+        });
+    }
+    for (thread& th : pool) th.join();
+    return *max_element(seconds.begin(), seconds.end());
+}
+
+int main(int argc, char** argv) {
+    int n = argc > 1 ? stoi(argv[1]) : 1 << 20;
+    long long m = argc > 2 ? stoll(argv[2]) : 5LL << 20;
+    int Q = argc > 3 ? stoi(argv[3]) : 2000;
+    int threads = argc > 4 ? stoi(argv[4]) : 1;
+    int maxSlots = argc > 5 ? stoi(argv[5]) : 16;
+    int hops = argc > 6 ? stoi(argv[6]) : 1;
+    GenOptions opt;
+    if (argc > 7) opt.seed = stoull(argv[7]);
+
+    Graph g = toGraph(n, generateGnm(n, m, opt));
+    vector<pair<int,int>> queries(Q);
+    for (int i = 0; i < Q; i++) {
+        int src = (int)(rngAt(opt.seed, i, 101) % n), target = (int)(rngAt(opt.seed, i, 102) % n);
+        if (hops > 0) {
+            target = src;
+            for (int h = 0; h < hops && !g.neighbors(target).empty(); h++) {
+                const AdjList& list = g.neighbors(target);
+                target = list[rngAt(opt.seed, i, 103 + h) % list.size()].first;
+            }
+        }
+        queries[i] = {src, target};
+    }
+    cout << "Graph: " << n << " vertices, " << g.edgeCount() << " edges | " << Q
+         << " queries on " << threads << " thread(s)\n";
+
+    // One slot runs the queries back to back through the same code
+    vector<int> expected;
+    double baseRate = 0;
+    cout << fixed;
+    for (int slots = 1; slots <= maxSlots; slots *= 2) {
+        vector<int> got(Q);
+        long long steps = 0;
+        mutex stepsLock;
+        double seconds = timeThreads(threads, Q, [&](int, size_t begin, size_t end) {
+            InterleavedQueries iq(g, slots);
+            vector<pair<int,int>> mine(queries.begin() + begin, queries.begin() + end);
+            vector<int> results;
+            iq.run(mine, results);
+            copy(results.begin(), results.end(), got.begin() + begin);
+            lock_guard<mutex> lock(stepsLock);
+            steps += iq.steps;
+        });
+
+        double rate = Q / seconds / threads;
+        if (slots == 1) {
+            expected = got;
+            baseRate = rate;
+        }
+        cout << (slots == 1 ? "Back to back      " : "Interleaved " + string(slots < 10 ? " " : "") + to_string(slots) + " slots")
+             << ": " << setprecision(1) << setw(9) << rate << " queries/s per thread ("
+             << setprecision(2) << rate / baseRate << "x) | " << steps << " steps | "
+             << (got == expected ? "results match" : "MISMATCH") << "\n";
+    }
+
+    // The pairing-heap query path must agree
+    QueryContext ctx(n);
+    int checked = min(Q, CHECK_QUERIES), mismatch = 0;
+    for (int i = 0; i < checked; i++) {
+        if (shortestPath(g, queries[i].first, queries[i].second, ctx) != expected[i]) mismatch++;
+    }
+    cout << "shortestPath check: " << checked << " queries, "
+         << (mismatch ? "MISMATCH" : "distances match") << "\n";
+
+    printMemoryReport();
+    return 0;
+}
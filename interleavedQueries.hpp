@@ -0,0 +1,210 @@
+/*
+ * INTERLEAVED SHORTEST-PATH QUERIES
+ *
+ * Runs several independent point-to-point Dijkstra queries on one thread,
+ * round-robin, so that the cache misses of one query overlap with work on
+ * the others (asynchronous memory access chaining, AMAC). Each query is a
+ * small state machine. Every step issues software prefetches for what its
+ * next step will touch and then yields to the next slot:
+ *
+ *   SETTLE     pop the heap minimum u; prefetch u's adjacency list header
+ *   LIST       prefetch the neighbor array of u
+ *   VERTICES   prefetch each neighbor's workspace entries
+ *   RELAX      relax the edges (loads should now hit cache), push the
+ *              improvements, prefetch what the next SETTLE checks
+ *
+ * With S slots, a prefetch has S - 1 other steps to complete before its data
+ * is used. Each slot owns a binary heap of (dist, vertex) entries in one
+ * array, with lazy deletion: settled vertices are skipped when popped. The
+ * pairing heap behind shortestPath is not used here, because its time goes
+ * to pointer-chasing heap work (cut is O(siblings)) rather than to the graph
+ * loads this engine overlaps. Per-vertex state is packed into one 16-byte
+ * record, so a relaxation misses on one line instead of one per
+ * QueryWorkspace array. Records carry the epoch of the query that wrote
+ * them, so starting a query is O(1). Distances equal shortestPath's.
+ *
+ * Slot count is a trade-off: more slots overlap more misses, but each slot's
+ * heap and touched records compete for cache. Two to four slots is best on
+ * the machines measured so far; see interleavedQueries.cpp.
+ *
+ * PUBLIC INTERFACE:
+ * ------------------------------------------------
+ * InterleavedQueries iq(g, slots);            // slots = queries in flight
+ * iq.run(queries, results);                   // queries: (src, target) pairs,
+ *                                             // results[i] = dist, INT_MAX if unreachable
+ *                                             // (target = -1 settles src's component, result 0)
+ * iq.steps                                    // state-machine steps executed
+ */
+
+#ifndef INTERLEAVED_QUERIES_HPP
+#define INTERLEAVED_QUERIES_HPP
+
+#include <vector>
+#include <climits>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include "graph.hpp"
+#include "memoryTracker.hpp"
+
+#if defined(__GNUC__) || defined(__clang__)
+#define QUERY_PREFETCH(addr) __builtin_prefetch(addr)
+#else
+#define QUERY_PREFETCH(addr) ((void)0)
+#endif
+
+class InterleavedQueries {
+    public:
+        long long steps = 0;
+
+        InterleavedQueries(const Graph& g, int slots) : g(g) {
+            for (int i = 0; i < std::max(slots, 1); i++) {
+                this->slots.emplace_back();
+                this->slots.back().vertex.resize(g.V);
+            }
+        }
+
+        template <typename Queries, typename Results>
+        void run(const Queries& queries, Results& results) {
+            results.assign(queries.size(), INT_MAX);
+            size_t next = 0;
+            int active = 0;
+            for (Slot& s : slots) {
+                if (start(s, queries, next)) active++;
+            }
+
+            while (active > 0) {
+                for (Slot& s : slots) {
+                    if (s.state == IDLE) continue;
+                    if (step(s)) continue;
+
+                    results[s.query] = s.result;
+                    if (!start(s, queries, next)) active--;
+                }
+            }
+        }
+
+    private:
+        enum State { IDLE, SETTLE, LIST, VERTICES, RELAX };
+
+        typedef std::pair<int,int> Entry; // (dist, vertex)
+
+        struct VertexState {
+            uint32_t seen = 0;    // epoch in which dist was written
+            uint32_t settled = 0; // epoch in which the vertex was settled
+            int dist = INT_MAX;
+            int parent = -1;
+        };
+
+        struct Slot {
+            WorkspaceVector<VertexState> vertex;
+            uint32_t epoch = 0;
+            HeapScratchVector<Entry> heap;
+            State state = IDLE;
+            size_t query = 0;
+            int target = -1;
+            int result = INT_MAX;
+            int u = -1;
+        };
+
+        const Graph& g;
+        std::vector<Slot> slots;
+
+        template <typename Queries>
+        bool start(Slot& s, const Queries& queries, size_t& next) {
+            if (next == queries.size()) {
+                s.state = IDLE;
+                return false;
+            }
+            s.query = next++;
+            auto [src, target] = queries[s.query];
+            s.target = target;
+            s.result = target < 0 ? 0 : INT_MAX; // as shortestPath
+
+            // Stamps wrapped around: clear them once every 2^32 queries
+            if (++s.epoch == 0) {
+                std::fill(s.vertex.begin(), s.vertex.end(), VertexState());
+                s.epoch = 1;
+            }
+            s.vertex[src] = {s.epoch, 0, 0, -1};
+            s.heap.clear();
+            s.heap.push_back({0, src});
+            s.state = SETTLE;
+            return true;
+        }
+
+        // Advances one state; false once the query has finished
+        bool step(Slot& s) {
+            steps++;
+
+            switch (s.state) {
+            case SETTLE: {
+                int u;
+                do {
+                    if (s.heap.empty()) return finish(s);
+                    std::pop_heap(s.heap.begin(), s.heap.end(), std::greater<Entry>());
+                    u = s.heap.back().second;
+                    s.heap.pop_back();
+                } while (s.vertex[u].settled == s.epoch);
+
+                s.u = u;
+                s.vertex[u].settled = s.epoch;
+                if (u == s.target) {
+                    s.result = s.vertex[u].dist;
+                    return finish(s);
+                }
+                QUERY_PREFETCH(&g.adj[u]);
+                s.state = LIST;
+                return true;
+            }
+            case LIST: {
+                const AdjList& list = g.adj[s.u];
+                const char* first = (const char*)list.data();
+                const char* last = (const char*)(list.data() + list.size());
+                for (const char* p = first; p < last; p += 64) QUERY_PREFETCH(p);
+                s.state = VERTICES;
+                return true;
+            }
+            case VERTICES: {
+                for (auto [v, w] : g.neighbors(s.u)) {
+                    QUERY_PREFETCH(&s.vertex[v]);
+                }
+                s.state = RELAX;
+                return true;
+            }
+            case RELAX: {
+                int du = s.vertex[s.u].dist;
+                for (auto [v, w] : g.neighbors(s.u)) {
+                    VertexState& sv = s.vertex[v];
+                    if (sv.seen != s.epoch) sv = {s.epoch, 0, INT_MAX, -1};
+                    if (sv.settled == s.epoch || du + w >= sv.dist) continue;
+                    sv.dist = du + w;
+                    sv.parent = s.u;
+                    s.heap.push_back({du + w, v});
+                    std::push_heap(s.heap.begin(), s.heap.end(), std::greater<Entry>());
+                }
+
+                // The next SETTLE checks the top's settled flag and, most
+                // likely, scans its adjacency
+                if (!s.heap.empty()) {
+                    int top = s.heap.front().second;
+                    QUERY_PREFETCH(&s.vertex[top]);
+                    QUERY_PREFETCH(&g.adj[top]);
+                }
+                s.state = SETTLE;
+                return true;
+            }
+            case IDLE:
+                break;
+            }
+            return false;
+        }
+
+        bool finish(Slot& s) {
+            s.state = IDLE;
+            return false;
+        }
+};
+
+#endif // INTERLEAVED_QUERIES_HPP
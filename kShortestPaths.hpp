@@ -0,0 +1,230 @@
+/*
+ * K SHORTEST PATHS (Eppstein)
+ *
+ * Enumerates the k shortest s-t paths in nondecreasing length. Paths may
+ * repeat vertices (they are walks), as in Eppstein's formulation.
+ *
+ *   1. Dijkstra from the target gives dist(v) = d(v, t) and a tree edge
+ *      v -> next(v) towards t (the graph is undirected, so this is the
+ *      reverse shortest-path tree).
+ *   2. Every other edge (v, u, w) is a sidetrack costing
+ *      w + dist(u) - dist(v) >= 0. Any s-t path is the shortest path with a
+ *      sequence of sidetracks, and its length is dist(s) + their costs.
+ *   3. H(v) holds the sidetracks leaving the tree path v -> t. It is a
+ *      persistent leftist heap: H(v) = meld(H(next(v)), own sidetracks of v),
+ *      and the meld copies only the O(log n) nodes on its merge path, so
+ *      every H(v) shares structure with its tree parent.
+ *   4. The next path is found by replacing the last sidetrack with one of
+ *      its two heap children, or by appending the root of H(head of the last
+ *      sidetrack). A binary heap over these candidates yields k paths.
+ *
+ * Building is O(m + n log n) (own sidetracks are heapified in O(deg)), each
+ * query is O(k log k). One engine answers any number of sources for its
+ * target.
+ *
+ * The heap is leftist rather than pairing/binomial: those need O(log n)
+ * amortized restructuring that path copying cannot share, whereas a leftist
+ * meld only touches its right spines.
+ *
+ * PUBLIC INTERFACE:
+ * ------------------------------------------------
+ * QueryContext ctx(g.V);
+ * KShortestPaths ksp(g, target, ctx);                 // uses ctx for the Dijkstra
+ * vector<long long> len = ksp.lengths(src, k);        // at most k, nondecreasing
+ * vector<vector<int>> p = ksp.paths(src, k);          // vertex sequences, same order
+ * size_t n = ksp.heap_nodes();                        // persistent heap size
+ */
+
+#ifndef K_SHORTEST_PATHS_HPP
+#define K_SHORTEST_PATHS_HPP
+
+#include <vector>
+#include <queue>
+#include <tuple>
+#include <climits>
+#include <algorithm>
+#include <functional>
+#include "graph.hpp"
+#include "graphQueries.hpp"
+#include "memoryTracker.hpp"
+
+class KShortestPaths {
+    public:
+        KShortestPaths(const Graph& graph, int target, QueryContext& ctx)
+            : g(graph), t(target), dist(graph.V), next(graph.V), heapOf(graph.V, -1) {
+            shortestPathTree(g, t, ctx);
+            for (int v = 0; v < g.V; v++) {
+                dist[v] = ctx.ws.dist(v);
+                next[v] = ctx.ws.parent(v);
+            }
+            buildHeaps();
+        }
+
+        std::vector<long long> lengths(int src, int k) {
+            enumerate(src, k);
+            std::vector<long long> out;
+            out.reserve(found.size());
+            for (const Found& f : found) out.push_back(f.length);
+            return out;
+        }
+
+        std::vector<std::vector<int>> paths(int src, int k) {
+            enumerate(src, k);
+            std::vector<std::vector<int>> out;
+            out.reserve(found.size());
+            for (int i = 0; i < (int)found.size(); i++) out.push_back(pathOf(src, i));
+            return out;
+        }
+
+        size_t heap_nodes() const {
+            return nodes.size();
+        }
+
+    private:
+        struct SidetrackNode {
+            long long key;   // sidetrack cost
+            int rank;        // leftist rank (null = 0)
+            int left, right; // indices into nodes, -1 = null
+            int from, to;    // the sidetrack edge
+        };
+
+        // A path found so far: its last sidetrack and the path it extends
+        struct Found {
+            long long length;
+            int node; // -1 for the shortest path
+            int prev;
+        };
+
+        const Graph& g;
+        int t;
+        ScratchVector<int> dist;   // d(v, t), INT_MAX if unreachable
+        ScratchVector<int> next;   // tree edge towards t, -1 at t / unreachable
+        ScratchVector<int> heapOf; // root of H(v), -1 if empty
+        std::vector<SidetrackNode, TrackingAllocator<SidetrackNode, MEM_HEAP_NODES>> nodes;
+        ScratchVector<Found> found;
+
+        int rank(int h) const {
+            return h < 0 ? 0 : nodes[h].rank;
+        }
+
+        int newNode(long long key, int from, int to) {
+            nodes.push_back({key, 1, -1, -1, from, to});
+            return (int)nodes.size() - 1;
+        }
+
+        // Leftist meld. With copy, the nodes on the merge path are copied so
+        // both inputs stay intact; without it, a and b are modified in place.
+        // Indices, not pointers: nodes may reallocate during the recursion.
+        int meld(int a, int b, bool copy) {
+            if (a < 0) return b;
+            if (b < 0) return a;
+            if (nodes[b].key < nodes[a].key) std::swap(a, b);
+
+            int c = a;
+            if (copy) {
+                nodes.push_back(nodes[a]);
+                c = (int)nodes.size() - 1;
+            }
+            int r = meld(nodes[c].right, b, copy);
+            nodes[c].right = r;
+            if (rank(nodes[c].left) < rank(r)) std::swap(nodes[c].left, nodes[c].right);
+            nodes[c].rank = rank(nodes[c].right) + 1;
+            return c;
+        }
+
+        void buildHeaps() {
+            // Own sidetracks of each vertex, heapified by melding pairs
+            // round-robin, which is linear in the number of sidetracks
+            ScratchVector<int> queue;
+            for (int v = 0; v < g.V; v++) {
+                if (dist[v] == INT_MAX) continue;
+
+                queue.clear();
+                bool skipTree = next[v] >= 0;
+                for (auto [u, w] : g.neighbors(v)) {
+                    if (dist[u] == INT_MAX) continue;
+                    if (skipTree && u == next[v] && (long long)dist[u] + w == dist[v]) {
+                        skipTree = false; // the tree edge itself (one copy only)
+                        continue;
+                    }
+                    queue.push_back(newNode((long long)w + dist[u] - dist[v], v, u));
+                }
+
+                for (size_t head = 0; head + 1 < queue.size(); head += 2) {
+                    queue.push_back(meld(queue[head], queue[head + 1], false));
+                }
+                heapOf[v] = queue.empty() ? -1 : queue.back();
+            }
+
+            // H(v) = meld(H(next(v)), own(v)), parents first. Walking up the
+            // tree handles zero-weight edges, where dist does not order them.
+            ScratchVector<char> built(g.V, 0);
+            ScratchVector<int> chain;
+            for (int v = 0; v < g.V; v++) {
+                if (dist[v] == INT_MAX || built[v]) continue;
+
+                chain.clear();
+                for (int x = v; x >= 0 && !built[x]; x = next[x]) chain.push_back(x);
+                for (int i = (int)chain.size() - 1; i >= 0; i--) {
+                    int x = chain[i];
+                    if (next[x] >= 0) heapOf[x] = meld(heapOf[next[x]], heapOf[x], true);
+                    built[x] = 1;
+                }
+            }
+        }
+
+        void enumerate(int src, int k) {
+            found.clear();
+            if (k <= 0 || dist[src] == INT_MAX) return;
+
+            found.push_back({dist[src], -1, -1});
+
+            // (length, heap node, index in found of the path it extends)
+            typedef std::tuple<long long, int, int> Candidate;
+            std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> candidates;
+            if (heapOf[src] >= 0) {
+                candidates.push({dist[src] + nodes[heapOf[src]].key, heapOf[src], 0});
+            }
+
+            while ((int)found.size() < k && !candidates.empty()) {
+                auto [length, n, prev] = candidates.top();
+                candidates.pop();
+                int index = (int)found.size();
+                found.push_back({length, n, prev});
+
+                const SidetrackNode& node = nodes[n];
+                // Swap the last sidetrack for the next-best one in its heap
+                for (int child : {node.left, node.right}) {
+                    if (child >= 0) candidates.push({length - node.key + nodes[child].key, child, prev});
+                }
+                // Or keep it and take another after its head
+                int h = heapOf[node.to];
+                if (h >= 0) candidates.push({length + nodes[h].key, h, index});
+            }
+        }
+
+        // Follows the tree from src, taking each sidetrack of found[i] in order
+        std::vector<int> pathOf(int src, int i) const {
+            std::vector<int> sidetracks;
+            for (int f = i; found[f].node >= 0; f = found[f].prev) sidetracks.push_back(found[f].node);
+            std::reverse(sidetracks.begin(), sidetracks.end());
+
+            std::vector<int> path = {src};
+            int cur = src;
+            for (int s : sidetracks) {
+                while (cur != nodes[s].from) {
+                    cur = next[cur];
+                    path.push_back(cur);
+                }
+                cur = nodes[s].to;
+                path.push_back(cur);
+            }
+            while (cur != t) {
+                cur = next[cur];
+                path.push_back(cur);
+            }
+            return path;
+        }
+};
+
+#endif // K_SHORTEST_PATHS_HPP
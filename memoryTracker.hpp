@@ -0,0 +1,200 @@
+/*
+ * MEMORY TRACKER
+ *
+ * Per-subsystem allocation counters: current bytes, peak bytes, allocation
+ * and free counts. Bytes are what the allocator actually hands out
+ * (malloc_usable_size plus the chunk header), not sizeof(T), so allocator
+ * overhead and rounding are included.
+ *
+ * PUBLIC INTERFACE:
+ * ------------------------------------------------
+ * TrackingAllocator<T, MEM_GRAPH>   // std::allocator replacement for containers
+ * GraphVector<T> / HeapScratchVector<T> / ScratchVector<T> / WorkspaceVector<T>
+ * trackedAlloc(MEM_HEAP_NODES, n)   // for class-specific operator new
+ * memResetPeaks();                  // peak = current, before a measured run
+ * printMemoryReport();              // table of all subsystems + RSS cross-check
+ *
+ * Define NO_MEMORY_TRACKING to compile the counters out.
+ */
+
+#ifndef MEMORY_TRACKER_HPP
+#define MEMORY_TRACKER_HPP
+
+#include <atomic>
+#include <cstdlib>
+#include <cstddef>
+#include <new>
+#include <vector>
+#include <fstream>
+#include <string>
+#include <iostream>
+#include <iomanip>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+enum MemSubsystem {
+    MEM_GRAPH,         // adjacency lists
+    MEM_HEAP_NODES,    // pairing/binomial heap nodes
+    MEM_HEAP_SCRATCH,  // temporary buffers inside heap operations
+    MEM_SCRATCH,       // per-run dist/done/handle arrays
+    MEM_WORKSPACE,     // reusable QueryWorkspace arrays
+    MEM_SUBSYSTEM_COUNT
+};
+
+inline const char* memSubsystemName(int sub) {
+    static const char* names[MEM_SUBSYSTEM_COUNT] = {
+        "graph", "heap nodes", "heap scratch", "scratch", "workspace"
+    };
+    return names[sub];
+}
+
+struct MemCounters {
+    std::atomic<long long> current{0};
+    std::atomic<long long> peak{0};
+    std::atomic<long long> allocs{0};
+    std::atomic<long long> frees{0};
+};
+
+inline MemCounters memCounters[MEM_SUBSYSTEM_COUNT];
+
+// Bytes the allocator really reserved for block p of requested size n
+inline size_t memFootprint(void* p, size_t n) {
+#if defined(__GLIBC__)
+    (void)n;
+    return malloc_usable_size(p) + sizeof(size_t);
+#else
+    (void)p;
+    return n;
+#endif
+}
+
+inline void memRecordAlloc(int sub, size_t bytes) {
+#ifndef NO_MEMORY_TRACKING
+    MemCounters& c = memCounters[sub];
+    long long now = c.current.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    long long peak = c.peak.load(std::memory_order_relaxed);
+    while (now > peak && !c.peak.compare_exchange_weak(peak, now, std::memory_order_relaxed)) {}
+    c.allocs.fetch_add(1, std::memory_order_relaxed);
+#else
+    (void)sub; (void)bytes;
+#endif
+}
+
+inline void memRecordFree(int sub, size_t bytes) {
+#ifndef NO_MEMORY_TRACKING
+    MemCounters& c = memCounters[sub];
+    c.current.fetch_sub(bytes, std::memory_order_relaxed);
+    c.frees.fetch_add(1, std::memory_order_relaxed);
+#else
+    (void)sub; (void)bytes;
+#endif
+}
+
+inline void* trackedAlloc(int sub, size_t n) {
+    void* p = std::malloc(n ? n : 1);
+    if (!p) throw std::bad_alloc();
+#ifndef NO_MEMORY_TRACKING
+    memRecordAlloc(sub, memFootprint(p, n));
+#else
+    (void)sub;
+#endif
+    return p;
+}
+
+inline void trackedFree(int sub, void* p, size_t n) {
+    if (!p) return;
+#ifndef NO_MEMORY_TRACKING
+    memRecordFree(sub, memFootprint(p, n));
+#else
+    (void)sub; (void)n;
+#endif
+    std::free(p);
+}
+
+template <typename T, int Sub>
+struct TrackingAllocator {
+    typedef T value_type;
+
+    template <typename U>
+    struct rebind { typedef TrackingAllocator<U, Sub> other; };
+
+    TrackingAllocator() noexcept {}
+    template <typename U>
+    TrackingAllocator(const TrackingAllocator<U, Sub>&) noexcept {}
+
+    T* allocate(size_t n) {
+        return static_cast<T*>(trackedAlloc(Sub, n * sizeof(T)));
+    }
+
+    void deallocate(T* p, size_t n) noexcept {
+        trackedFree(Sub, p, n * sizeof(T));
+    }
+
+    template <typename U>
+    bool operator==(const TrackingAllocator<U, Sub>&) const noexcept { return true; }
+    template <typename U>
+    bool operator!=(const TrackingAllocator<U, Sub>&) const noexcept { return false; }
+};
+
+template <typename T> using GraphVector = std::vector<T, TrackingAllocator<T, MEM_GRAPH>>;
+template <typename T> using HeapScratchVector = std::vector<T, TrackingAllocator<T, MEM_HEAP_SCRATCH>>;
+template <typename T> using ScratchVector = std::vector<T, TrackingAllocator<T, MEM_SCRATCH>>;
+template <typename T> using WorkspaceVector = std::vector<T, TrackingAllocator<T, MEM_WORKSPACE>>;
+
+// Start a new measurement window: peaks drop to the current level
+inline void memResetPeaks() {
+    for (auto& c : memCounters) {
+        c.peak.store(c.current.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+}
+
+inline long long memTotalCurrent() {
+    long long total = 0;
+    for (auto& c : memCounters) total += c.current.load(std::memory_order_relaxed);
+    return total;
+}
+
+// VmRSS / VmHWM from /proc/self/status in bytes, -1 if unavailable
+inline long long readProcStatusKB(const std::string& field) {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, field.size(), field) == 0 && line.size() > field.size() && line[field.size()] == ':') {
+            return std::atoll(line.c_str() + field.size() + 1) * 1024;
+        }
+    }
+    return -1;
+}
+
+inline long long currentRSS() { return readProcStatusKB("VmRSS"); }
+inline long long peakRSS() { return readProcStatusKB("VmHWM"); }
+
+inline void printMemoryReport(std::ostream& out = std::cout) {
+    std::ios_base::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+    out << "  " << std::left << std::setw(14) << "subsystem" << std::right
+        << std::setw(12) << "current KB" << std::setw(12) << "peak KB"
+        << std::setw(12) << "allocs" << std::setw(12) << "frees" << "\n";
+    long long peakSum = 0;
+    for (int s = 0; s < MEM_SUBSYSTEM_COUNT; s++) {
+        const MemCounters& c = memCounters[s];
+        peakSum += c.peak.load();
+        out << "  " << std::left << std::setw(14) << memSubsystemName(s) << std::right
+            << std::setw(12) << std::fixed << std::setprecision(1) << c.current.load() / 1024.0
+            << std::setw(12) << c.peak.load() / 1024.0
+            << std::setw(12) << c.allocs.load()
+            << std::setw(12) << c.frees.load() << "\n";
+    }
+    out << "  tracked total: " << memTotalCurrent() / 1024.0 << " KB current, <= "
+        << peakSum / 1024.0 << " KB peak\n";
+    long long rss = currentRSS(), hwm = peakRSS();
+    if (rss >= 0) {
+        out << "  process RSS:   " << rss / 1024.0 << " KB current, " << hwm / 1024.0 << " KB peak\n";
+    }
+    out.flags(flags);
+    out.precision(precision);
+}
+
+#endif // MEMORY_TRACKER_HPP
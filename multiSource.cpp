@@ -0,0 +1,96 @@
+/*
+ * MULTI-SOURCE DIJKSTRA / GRAPH VORONOI DEMO
+ * Assigns every vertex to its nearest source (facility) with one
+ * multi-source traversal, and compares against running one single-source
+ * Dijkstra per source and taking the minimum.
+ *
+ * Usage: multiSource [n] [m] [sources] [seed]
+ */
+
+#include <bits/stdc++.h>
+#include "graphGenerator.hpp"
+#include "graphQueries.hpp"
+
+using namespace std;
+
+double msSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv) {
+    int n = argc > 1 ? stoi(argv[1]) : 100000;
+    long long m = argc > 2 ? stoll(argv[2]) : 500000;
+    int k = argc > 3 ? stoi(argv[3]) : 64;
+    GenOptions opt;
+    if (argc > 4) opt.seed = stoull(argv[4]);
+
+    Graph g = toGraph(n, generateGnm(n, m, opt));
+    QueryContext ctx(g.V);
+
+    vector<int> sources;
+    for (int i = 0; i < k; i++) sources.push_back((int)(rngAt(opt.seed, i, 99) % n));
+    cout << "Graph: " << n << " vertices, " << g.edgeCount() << " edges, " << k << " sources\n";
+
+    /* =======================
+       ONE PASS
+       ======================= */
+
+    auto start = chrono::steady_clock::now();
+    VoronoiPartition part = voronoiPartition(g, sources, ctx);
+    double onePassMs = msSince(start);
+
+    vector<int> cellSize(k, 0);
+    int unreachable = 0;
+    for (int v = 0; v < n; v++) {
+        if (part.cell[v] < 0) unreachable++;
+        else cellSize[part.cell[v]]++;
+    }
+    cout << "Multi-source pass: " << onePassMs << " ms | boundary edges " << part.boundary.size()
+         << " | cells " << *min_element(cellSize.begin(), cellSize.end()) << " .. "
+         << *max_element(cellSize.begin(), cellSize.end()) << " vertices"
+         << " | unreachable " << unreachable << "\n";
+
+    /* =======================
+       ONE RUN PER SOURCE
+       ======================= */
+
+    start = chrono::steady_clock::now();
+    vector<int> best(n, INT_MAX);
+    vector<vector<int>> perSource(k);
+    for (int i = 0; i < k; i++) {
+        shortestPathTree(g, sources[i], ctx);
+        perSource[i].resize(n);
+        for (int v = 0; v < n; v++) {
+            perSource[i][v] = ctx.ws.dist(v);
+            best[v] = min(best[v], perSource[i][v]);
+        }
+    }
+    double perSourceMs = msSince(start);
+
+    // Distances must match the minimum, and each vertex's cell must be a
+    // source at that minimum distance (ties may pick any of them)
+    long long distMismatch = 0, cellMismatch = 0, boundaryMismatch = 0;
+    for (int v = 0; v < n; v++) {
+        if (part.dist[v] != best[v]) distMismatch++;
+        if (part.cell[v] >= 0 && perSource[part.cell[v]][v] != best[v]) cellMismatch++;
+    }
+    long long expectedBoundary = 0;
+    for (int u = 0; u < n; u++) {
+        for (auto [v, w] : g.neighbors(u)) {
+            if (u < v && part.cell[u] >= 0 && part.cell[v] >= 0 && part.cell[u] != part.cell[v]) expectedBoundary++;
+        }
+    }
+    for (const BoundaryEdge& e : part.boundary) {
+        if (part.cell[e.u] == part.cell[e.v]) boundaryMismatch++;
+    }
+    if (expectedBoundary != (long long)part.boundary.size()) boundaryMismatch++;
+
+    cout << "One Dijkstra per source: " << perSourceMs << " ms ("
+         << perSourceMs / onePassMs << "x the single pass)\n";
+    cout << "Check: dist " << (distMismatch ? "MISMATCH" : "ok")
+         << " | cells " << (cellMismatch ? "MISMATCH" : "ok")
+         << " | boundary " << (boundaryMismatch ? "MISMATCH" : "ok") << "\n";
+
+    printMemoryReport();
+    return 0;
+}
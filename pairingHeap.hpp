@@ -10,7 +10,10 @@
  * int min_key = pq.find_min();                 // Peek at minimum key
  * int min_key = pq.extract_min();              // Remove and return minimum key
  * pq.decrease_key(node, new_key);              // Decrease key of a node
+ * pq.decrease_keys(batch);                     // Many decreases, one meld into the root
+ *                                              // (batch: vector of (node, new_key))
  * bool is_empty = pq.empty();                  // Check if heap is empty
+ * pq.clear();                                  // Free all remaining nodes
  * pq.print_stats();                            // Print performance statistics
  */
 
@@ -19,8 +22,9 @@
 
 #include <vector>
 #include <stdexcept>
-#include <chrono>
 #include <iostream>
+#include "memoryTracker.hpp"
+#include "heapTiming.hpp"
 
 // Heap structure
 struct HeapNode {
@@ -43,6 +47,10 @@ struct HeapNode {
         node->sibling = child;
         child = node;
     }
+
+    // Counted under MEM_HEAP_NODES
+    static void* operator new(size_t size) { return trackedAlloc(MEM_HEAP_NODES, size); }
+    static void operator delete(void* p, size_t size) { trackedFree(MEM_HEAP_NODES, p, size); }
 };
 
 struct PairingHeap {
@@ -74,7 +82,7 @@ struct PairingHeap {
         */
 
     HeapNode* extract_min() {
-        auto start = std::chrono::high_resolution_clock::now();
+        HeapOpTimer timer(extract_min_time);
     
         if (!root) throw std::runtime_error("Heap is empty");
 
@@ -83,44 +91,72 @@ struct PairingHeap {
 
         if (root) root->parent = nullptr; 
 
-        auto end = std::chrono::high_resolution_clock::now();
-        extract_min_time += std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
         extract_min_count++;
 
         return old_root;
     }
 
     void decrease_key(HeapNode* node, int new_key) {
-        auto start = std::chrono::high_resolution_clock::now();
+        HeapOpTimer timer(decrease_key_time);
+        decrease_key_count++;
         
-        if (new_key > node->key) {
-            auto end = std::chrono::high_resolution_clock::now();
-            decrease_key_time += std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
-            decrease_key_count++;
-            return;
-        }
+        if (new_key > node->key) return;
         
         node->key = new_key;
 
-        if (node == root) {
-            auto end = std::chrono::high_resolution_clock::now();
-            decrease_key_time += std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
-            decrease_key_count++;
-            return;
-        }
+        if (node == root) return;
 
         cut(node);
         root = merge(root, node);
-        
-        auto end = std::chrono::high_resolution_clock::now();
-        decrease_key_time += std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
-        decrease_key_count++;
+    }
+
+    // Applies every (node, new_key) pair. Nodes that now beat their parent
+    // are cut, paired into one tree, and that tree is melded into the root
+    // once, instead of one root meld per node.
+    template <typename Batch>
+    void decrease_keys(const Batch& batch) {
+        HeapOpTimer timer(decrease_key_time);
+
+        HeapNode* cut_list = nullptr; // cut nodes chained through sibling
+        for (const auto& [node, new_key] : batch) {
+            decrease_key_count++;
+            if (new_key > node->key) continue;
+            node->key = new_key;
+
+            if (node == root) continue;
+            if (!node->parent) continue; // already cut earlier in this batch
+            if (node->parent->key <= new_key) continue; // heap order still holds
+
+            cut(node);
+            node->sibling = cut_list;
+            cut_list = node;
+        }
+
+        if (cut_list) {
+            HeapNode* tree = merge_pairs(cut_list);
+            tree->parent = nullptr;
+            root = merge(root, tree);
+        }
     }
 
     bool empty() {
         return root == nullptr;
     }
 
+    // Frees every node still in the heap
+    void clear() {
+        if (!root) return;
+        HeapScratchVector<HeapNode*> stack = {root};
+        while (!stack.empty()) {
+            HeapNode* n = stack.back();
+            stack.pop_back();
+            if (n->child) stack.push_back(n->child);
+            if (n->sibling) stack.push_back(n->sibling);
+            delete n;
+        }
+        root = nullptr;
+    }
+
     void join(PairingHeap& other) {
         root = merge(root, other.root);
         other.root = nullptr;
@@ -160,7 +196,7 @@ private:
         if (!first_child) return nullptr;
         if (!first_child->sibling) return first_child;
 
-        std::vector<HeapNode*> trees;
+        HeapScratchVector<HeapNode*> trees;
         HeapNode* curr = first_child;
 
         while (curr) {
@@ -205,4 +241,4 @@ private:
     }
 };
 
-#endif // PAIRING_HEAP_HPP
\ No newline at end of file
+#endif // PAIRING_HEAP_HPP
@@ -0,0 +1,95 @@
+/*
+ * HARDWARE CACHE COUNTERS
+ * Thin wrapper over Linux perf_event_open for cache references/misses.
+ * When counters are unavailable (non-Linux, containers, perf_event_paranoid)
+ * available() is false and reads return -1, so callers can print "n/a".
+ *
+ * PerfCounters pc;
+ * pc.start();  ...work...  pc.stop();
+ * pc.cache_misses, pc.cache_references, pc.l1d_misses
+ */
+
+#ifndef PERF_COUNTERS_HPP
+#define PERF_COUNTERS_HPP
+
+#include <cstdint>
+#include <cstring>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+struct PerfCounters {
+    long long cache_references = -1;
+    long long cache_misses = -1;
+    long long l1d_misses = -1;
+
+    int fds[3] = {-1, -1, -1};
+
+    PerfCounters() {
+#ifdef __linux__
+        fds[0] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES);
+        fds[1] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+        fds[2] = open_counter(PERF_TYPE_HW_CACHE,
+                              PERF_COUNT_HW_CACHE_L1D |
+                              (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                              (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+#endif
+    }
+
+    ~PerfCounters() {
+#ifdef __linux__
+        for (int fd : fds) {
+            if (fd >= 0) close(fd);
+        }
+#endif
+    }
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    bool available() const { return fds[1] >= 0; }
+
+    void start() {
+#ifdef __linux__
+        for (int fd : fds) {
+            if (fd < 0) continue;
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    void stop() {
+        long long* out[3] = {&cache_references, &cache_misses, &l1d_misses};
+        for (int i = 0; i < 3; i++) {
+            *out[i] = -1;
+#ifdef __linux__
+            if (fds[i] < 0) continue;
+            ioctl(fds[i], PERF_EVENT_IOC_DISABLE, 0);
+            long long value;
+            if (read(fds[i], &value, sizeof(value)) == (ssize_t)sizeof(value)) *out[i] = value;
+#endif
+        }
+    }
+
+private:
+#ifdef __linux__
+    static int open_counter(uint32_t type, uint64_t config) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    }
+#endif
+};
+
+#endif // PERF_COUNTERS_HPP
@@ -0,0 +1,547 @@
+/*
+ * GRAPH QUERY SERVICE
+ *
+ * Long-running daemon that loads a graph once and answers shortest-path,
+ * point-to-point and MST requests over a Unix domain socket. Requests from
+ * all connections go into one queue; each worker thread takes up to
+ * max_batch queued requests at a time and answers requests that share a
+ * source with a single traversal. Workers keep their heap and workspace
+ * (QueryContext) for their whole lifetime.
+ *
+ * Usage:
+ *   queryService serve <socket> gnm <n> <m> [workers] [max_batch]
+ *   queryService serve <socket> file <edges.txt> [workers] [max_batch]
+ *   queryService p2p <socket> <src> <dst>
+ *   queryService sssp <socket> <src>
+ *   queryService mst <socket> <start>
+ *   queryService metrics <socket>
+ *   queryService shutdown <socket>
+ *   queryService bench <socket> <clients> <queries_per_client>
+ *
+ * Wire protocol (host byte order, fixed-size little structs):
+ *   request:  Request{type, id, src, target}
+ *   response: ResponseHeader{id, status, value, payload_bytes}, then payload
+ *     P2P      value = distance (-1 unreachable)
+ *     SSSP     payload = V int32 distances (-1 unreachable), value = V
+ *     MST      value = weight of the spanning tree of start's component
+ *     METRICS  payload = text report
+ *   status: 0 ok, 1 bad request, 2 server shutting down (request not run)
+ */
+
+#include <bits/stdc++.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <signal.h>
+#include "graphGenerator.hpp"
+#include "graphQueries.hpp"
+
+using namespace std;
+
+/* =======================
+   PROTOCOL
+   ======================= */
+
+enum RequestType : uint32_t {
+    REQ_SSSP = 1,
+    REQ_P2P = 2,
+    REQ_MST = 3,
+    REQ_METRICS = 4,
+    REQ_SHUTDOWN = 5
+};
+
+enum ResponseStatus : uint32_t {
+    STATUS_OK = 0,
+    STATUS_BAD_REQUEST = 1,
+    STATUS_SHUTTING_DOWN = 2
+};
+
+struct Request {
+    uint32_t type;
+    uint32_t id;
+    int32_t src;
+    int32_t target;
+};
+
+struct ResponseHeader {
+    uint32_t id;
+    uint32_t status;
+    int64_t value;
+    uint32_t payload_bytes;
+    uint32_t reserved;
+};
+
+bool read_all(int fd, void* buf, size_t n) {
+    char* p = static_cast<char*>(buf);
+    while (n > 0) {
+        ssize_t r = recv(fd, p, n, 0);
+        if (r <= 0) {
+            if (r < 0 && errno == EINTR) continue;
+            return false;
+        }
+        p += r;
+        n -= r;
+    }
+    return true;
+}
+
+bool write_all(int fd, const void* buf, size_t n) {
+    const char* p = static_cast<const char*>(buf);
+    while (n > 0) {
+        ssize_t r = send(fd, p, n, MSG_NOSIGNAL);
+        if (r <= 0) {
+            if (r < 0 && errno == EINTR) continue;
+            return false;
+        }
+        p += r;
+        n -= r;
+    }
+    return true;
+}
+
+/* =======================
+   METRICS
+   ======================= */
+
+struct ServiceMetrics {
+    static const int BUCKETS = 40; // bucket i: latency in [2^(i-1), 2^i) us
+
+    atomic<long long> requests{0};
+    atomic<long long> batches{0};
+    atomic<long long> traversals{0};
+    atomic<long long> queue_depth{0};
+    atomic<long long> max_queue_depth{0};
+    atomic<long long> latency_total_us{0};
+    atomic<long long> latency_buckets[BUCKETS];
+
+    ServiceMetrics() {
+        for (auto& b : latency_buckets) b = 0;
+    }
+
+    void record_latency(long long us) {
+        int bucket = 0;
+        while (bucket < BUCKETS - 1 && (1LL << bucket) <= us) bucket++;
+        latency_buckets[bucket]++;
+        latency_total_us += us;
+        requests++;
+    }
+
+    void on_enqueue() {
+        long long depth = ++queue_depth;
+        long long seen = max_queue_depth.load();
+        while (depth > seen && !max_queue_depth.compare_exchange_weak(seen, depth)) {}
+    }
+
+    // Upper bound of the bucket holding quantile q, in microseconds
+    long long percentile(double q) const {
+        long long total = 0;
+        for (const auto& b : latency_buckets) total += b.load();
+        if (total == 0) return 0;
+        long long rank = (long long)ceil(q * total), seen = 0;
+        for (int i = 0; i < BUCKETS; i++) {
+            seen += latency_buckets[i].load();
+            if (seen >= rank) return 1LL << i;
+        }
+        return 1LL << (BUCKETS - 1);
+    }
+
+    string report() const {
+        ostringstream out;
+        long long n = requests.load(), b = batches.load();
+        out << "requests " << n << "\n"
+            << "batches " << b << "\n"
+            << "avg_batch_size " << (b ? n / (double)b : 0.0) << "\n"
+            << "traversals " << traversals.load() << "\n"
+            << "queue_depth " << queue_depth.load() << "\n"
+            << "max_queue_depth " << max_queue_depth.load() << "\n"
+            << "latency_avg_us " << (n ? latency_total_us.load() / (double)n : 0.0) << "\n"
+            << "latency_p50_us <= " << percentile(0.50) << "\n"
+            << "latency_p90_us <= " << percentile(0.90) << "\n"
+            << "latency_p99_us <= " << percentile(0.99) << "\n";
+        return out.str();
+    }
+};
+
+/* =======================
+   SERVER
+   ======================= */
+
+struct Connection {
+    int fd;
+    mutex write_mutex;
+
+    Connection(int f) : fd(f) {}
+    ~Connection() { close(fd); }
+
+    void respond(uint32_t id, uint32_t status, int64_t value,
+                 const void* payload = nullptr, uint32_t payload_bytes = 0) {
+        ResponseHeader h = {id, status, value, payload_bytes, 0};
+        lock_guard<mutex> lock(write_mutex);
+        if (write_all(fd, &h, sizeof(h)) && payload_bytes) write_all(fd, payload, payload_bytes);
+    }
+};
+
+struct Job {
+    Request req;
+    shared_ptr<Connection> conn;
+    chrono::steady_clock::time_point enqueued;
+};
+
+// Reader thread of one connection; done is set when the thread is about to
+// exit, so the accept loop can join it
+struct Reader {
+    shared_ptr<Connection> conn;
+    atomic<bool> done{false};
+    thread t;
+};
+
+struct QueryServer {
+    const Graph& g;
+    string path;
+    int workers;
+    int max_batch;
+    int listen_fd = -1;
+
+    mutex m;
+    condition_variable cv;
+    deque<Job> queue;
+    atomic<bool> stopping{false}; // written under m, so no job is queued after it is set
+    list<unique_ptr<Reader>> readers; // accept loop only
+    ServiceMetrics metrics;
+
+    QueryServer(const Graph& graph, const string& socket_path, int worker_count, int batch)
+        : g(graph), path(socket_path), workers(worker_count), max_batch(batch) {}
+
+    void run() {
+        listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        sockaddr_un addr = {};
+        addr.sun_family = AF_UNIX;
+        strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+        unlink(path.c_str());
+        if (listen_fd < 0 || ::bind(listen_fd, (sockaddr*)&addr, sizeof(addr)) < 0 || listen(listen_fd, 128) < 0) {
+            throw runtime_error("cannot listen on " + path + ": " + strerror(errno));
+        }
+
+        vector<thread> pool;
+        for (int i = 0; i < workers; i++) pool.emplace_back(&QueryServer::worker, this);
+
+        cerr << "Listening on " << path << " (" << workers << " workers, batch " << max_batch << ")\n";
+        while (!stopping) {
+            int fd = accept(listen_fd, nullptr, nullptr);
+            if (fd < 0) {
+                if (errno == EINTR) continue;
+                break; // listen socket shut down
+            }
+            reap_readers(false);
+            auto r = make_unique<Reader>();
+            r->conn = make_shared<Connection>(fd);
+            r->t = thread(&QueryServer::reader, this, r.get());
+            readers.push_back(move(r));
+        }
+
+        // Readers stop reading and reject anything they still parse; jobs
+        // already queued are answered by the workers before they exit. Only
+        // the read side is shut down so those answers can still be written.
+        stop();
+        for (auto& r : readers) shutdown(r->conn->fd, SHUT_RD);
+        reap_readers(true);
+        cv.notify_all();
+        for (auto& t : pool) t.join();
+        close(listen_fd);
+        unlink(path.c_str());
+        cerr << metrics.report();
+    }
+
+    void stop() {
+        lock_guard<mutex> lock(m);
+        stopping = true;
+    }
+
+    // Joins finished readers, or all of them when wait is set
+    void reap_readers(bool wait) {
+        for (auto it = readers.begin(); it != readers.end();) {
+            if (wait || (*it)->done) {
+                (*it)->t.join();
+                it = readers.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    // One thread per connection: parse requests and enqueue them
+    void reader(Reader* self) {
+        Connection* conn = self->conn.get();
+        Request req;
+        while (!stopping && read_all(conn->fd, &req, sizeof(req))) {
+            if (req.type == REQ_METRICS) {
+                string text = metrics.report();
+                conn->respond(req.id, STATUS_OK, 0, text.data(), text.size());
+            } else if (req.type == REQ_SHUTDOWN) {
+                conn->respond(req.id, STATUS_OK, 0);
+                stop();
+                shutdown(listen_fd, SHUT_RDWR);
+                cv.notify_all();
+            } else {
+                bool queued = false;
+                {
+                    lock_guard<mutex> lock(m);
+                    if (!stopping) {
+                        queue.push_back({req, self->conn, chrono::steady_clock::now()});
+                        queued = true;
+                    }
+                }
+                if (!queued) {
+                    conn->respond(req.id, STATUS_SHUTTING_DOWN, 0);
+                    break;
+                }
+                metrics.on_enqueue();
+                cv.notify_one();
+            }
+        }
+        self->done = true;
+    }
+
+    void worker() {
+        QueryContext ctx(g.V);
+        vector<Job> batch;
+        while (true) {
+            batch.clear();
+            {
+                unique_lock<mutex> lock(m);
+                cv.wait(lock, [&] { return stopping || !queue.empty(); });
+                if (queue.empty()) return; // stopping and drained
+                while (!queue.empty() && (int)batch.size() < max_batch) {
+                    batch.push_back(move(queue.front()));
+                    queue.pop_front();
+                }
+            }
+            metrics.queue_depth -= batch.size();
+            metrics.batches++;
+            process_batch(batch, ctx);
+        }
+    }
+
+    void finish(const Job& job, uint32_t status, int64_t value,
+                const void* payload = nullptr, uint32_t payload_bytes = 0) {
+        job.conn->respond(job.req.id, status, value, payload, payload_bytes);
+        auto now = chrono::steady_clock::now();
+        metrics.record_latency(chrono::duration_cast<chrono::microseconds>(now - job.enqueued).count());
+    }
+
+    bool valid_vertex(int v) const { return v >= 0 && v < g.V; }
+
+    // Requests with the same type class and source share one traversal
+    void process_batch(vector<Job>& batch, QueryContext& ctx) {
+        sort(batch.begin(), batch.end(), [](const Job& a, const Job& b) {
+            bool amst = a.req.type == REQ_MST, bmst = b.req.type == REQ_MST;
+            if (amst != bmst) return amst < bmst;
+            return a.req.src < b.req.src;
+        });
+
+        vector<int32_t> payload;
+        size_t i = 0;
+        while (i < batch.size()) {
+            size_t j = i;
+            bool mst = batch[i].req.type == REQ_MST;
+            while (j < batch.size() && (batch[j].req.type == REQ_MST) == mst && batch[j].req.src == batch[i].req.src) j++;
+
+            int src = batch[i].req.src;
+            if (!valid_vertex(src)) {
+                for (size_t k = i; k < j; k++) finish(batch[k], STATUS_BAD_REQUEST, 0);
+                i = j;
+                continue;
+            }
+
+            if (mst) {
+                long long weight = mstWeight(g, src, ctx);
+                metrics.traversals++;
+                for (size_t k = i; k < j; k++) finish(batch[k], STATUS_OK, weight);
+                i = j;
+                continue;
+            }
+
+            bool full = (j - i) > 1;
+            for (size_t k = i; k < j; k++) {
+                if (batch[k].req.type == REQ_SSSP) full = true;
+            }
+
+            if (!full) {
+                const Job& job = batch[i];
+                if (job.req.type != REQ_P2P || !valid_vertex(job.req.target)) {
+                    finish(job, STATUS_BAD_REQUEST, 0);
+                } else {
+                    int d = shortestPath(g, src, job.req.target, ctx);
+                    metrics.traversals++;
+                    finish(job, STATUS_OK, d == INT_MAX ? -1 : d);
+                }
+                i = j;
+                continue;
+            }
+
+            shortestPathTree(g, src, ctx);
+            metrics.traversals++;
+            for (size_t k = i; k < j; k++) {
+                const Job& job = batch[k];
+                if (job.req.type == REQ_SSSP) {
+                    payload.resize(g.V);
+                    for (int v = 0; v < g.V; v++) {
+                        int d = ctx.ws.dist(v);
+                        payload[v] = d == INT_MAX ? -1 : d;
+                    }
+                    finish(job, STATUS_OK, g.V, payload.data(), payload.size() * sizeof(int32_t));
+                } else if (job.req.type == REQ_P2P && valid_vertex(job.req.target)) {
+                    int d = ctx.ws.dist(job.req.target);
+                    finish(job, STATUS_OK, d == INT_MAX ? -1 : d);
+                } else {
+                    finish(job, STATUS_BAD_REQUEST, 0);
+                }
+            }
+            i = j;
+        }
+    }
+};
+
+/* =======================
+   CLIENT
+   ======================= */
+
+int connect_to(const string& path) {
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un addr = {};
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+    if (fd < 0 || connect(fd, (sockaddr*)&addr, sizeof(addr)) < 0) {
+        throw runtime_error("cannot connect to " + path + ": " + strerror(errno));
+    }
+    return fd;
+}
+
+// Sends one request and reads its response; payload is resized to fit
+ResponseHeader call(int fd, const Request& req, vector<char>& payload) {
+    ResponseHeader h;
+    if (!write_all(fd, &req, sizeof(req)) || !read_all(fd, &h, sizeof(h))) {
+        throw runtime_error("connection closed");
+    }
+    payload.resize(h.payload_bytes);
+    if (h.payload_bytes && !read_all(fd, payload.data(), h.payload_bytes)) {
+        throw runtime_error("connection closed");
+    }
+    return h;
+}
+
+// Closed-loop load: each client thread sends random P2P queries one at a time
+void run_bench(const string& path, int clients, int per_client, int V) {
+    vector<vector<long long>> latencies(clients);
+    vector<thread> pool;
+    auto start = chrono::steady_clock::now();
+    for (int c = 0; c < clients; c++) {
+        pool.emplace_back([&, c] {
+            int fd = connect_to(path);
+            vector<char> payload;
+            for (int q = 0; q < per_client; q++) {
+                uint64_t draw = 0;
+                Request req = {REQ_P2P, (uint32_t)q,
+                               (int32_t)rngBounded(c, q, draw, V), (int32_t)rngBounded(c, q, draw, V)};
+                auto t1 = chrono::steady_clock::now();
+                call(fd, req, payload);
+                auto t2 = chrono::steady_clock::now();
+                latencies[c].push_back(chrono::duration_cast<chrono::microseconds>(t2 - t1).count());
+            }
+            close(fd);
+        });
+    }
+    for (auto& t : pool) t.join();
+    auto end = chrono::steady_clock::now();
+
+    vector<long long> all;
+    for (auto& l : latencies) all.insert(all.end(), l.begin(), l.end());
+    sort(all.begin(), all.end());
+    double secs = chrono::duration<double>(end - start).count();
+    cout << "Queries: " << all.size() << " from " << clients << " clients in " << secs << " s ("
+         << all.size() / secs << " q/s)\n";
+    cout << "Client latency p50 " << all[all.size() / 2] << " us | p99 "
+         << all[min(all.size() - 1, all.size() * 99 / 100)] << " us\n";
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        cerr << "usage: " << argv[0] << " serve|p2p|sssp|mst|metrics|shutdown|bench <socket> ...\n";
+        return 1;
+    }
+    signal(SIGPIPE, SIG_IGN);
+    string mode = argv[1], path = argv[2];
+
+    try {
+        if (mode == "serve") {
+            if (argc < 5) throw runtime_error("serve needs a graph: gnm <n> <m> | file <path>");
+            string source = argv[3];
+            int next = 0;
+            auto load_start = chrono::steady_clock::now();
+            Graph g(0);
+            if (source == "gnm" && argc >= 6) {
+                int n = stoi(argv[4]);
+                g = toGraph(n, generateGnm(n, stoll(argv[5])));
+                next = 6;
+            } else if (source == "file") {
+                ifstream in(argv[4]);
+                if (!in) throw runtime_error(string("cannot open ") + argv[4]);
+                int n = 0;
+                vector<Edge> edges = readEdgeList(in, n);
+                g = toGraph(n, edges);
+                next = 5;
+            } else {
+                throw runtime_error("unknown graph source " + source);
+            }
+            auto load_end = chrono::steady_clock::now();
+            cerr << "Loaded graph: " << g.V << " vertices, " << g.edgeCount() << " edges in "
+                 << chrono::duration_cast<chrono::milliseconds>(load_end - load_start).count() << " ms\n";
+
+            int workers = argc > next ? stoi(argv[next]) : max(1u, thread::hardware_concurrency());
+            int batch = argc > next + 1 ? stoi(argv[next + 1]) : 32;
+            QueryServer server(g, path, workers, batch);
+            server.run();
+            return 0;
+        }
+
+        if (mode == "bench") {
+            if (argc < 5) throw runtime_error("bench needs <clients> <queries_per_client>");
+            int fd = connect_to(path);
+            vector<char> payload;
+            ResponseHeader h = call(fd, {REQ_SSSP, 0, 0, 0}, payload); // learns V
+            close(fd);
+            run_bench(path, stoi(argv[3]), stoi(argv[4]), (int)h.value);
+            return 0;
+        }
+
+        Request req = {0, 1, argc > 3 ? stoi(argv[3]) : 0, argc > 4 ? stoi(argv[4]) : 0};
+        if (mode == "p2p") req.type = REQ_P2P;
+        else if (mode == "sssp") req.type = REQ_SSSP;
+        else if (mode == "mst") req.type = REQ_MST;
+        else if (mode == "metrics") req.type = REQ_METRICS;
+        else if (mode == "shutdown") req.type = REQ_SHUTDOWN;
+        else throw runtime_error("unknown mode " + mode);
+
+        int fd = connect_to(path);
+        vector<char> payload;
+        ResponseHeader h = call(fd, req, payload);
+        close(fd);
+
+        if (h.status != STATUS_OK) {
+            cerr << "request failed with status " << h.status << "\n";
+            return 1;
+        }
+        if (req.type == REQ_METRICS) {
+            cout << string(payload.begin(), payload.end());
+        } else if (req.type == REQ_SSSP) {
+            const int32_t* dist = reinterpret_cast<const int32_t*>(payload.data());
+            for (int v = 0; v < h.value; v++) cout << v << ' ' << dist[v] << '\n';
+        } else if (req.type != REQ_SHUTDOWN) {
+            cout << h.value << '\n';
+        }
+    } catch (const exception& e) {
+        cerr << "error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,93 @@
+/*
+ * QUERY WORKSPACE
+ *
+ * Per-vertex scratch state (distance, parent, heap handle, settled flag) that
+ * is reused across Dijkstra/Prim queries on the same graph.
+ *
+ * Every entry remembers the epoch in which it was last written, so reset()
+ * is O(1): entries written in an older epoch read back as untouched
+ * (dist = INT_MAX, parent = -1, handle = null). Only the vertices a query
+ * actually reaches are ever written.
+ *
+ * PUBLIC INTERFACE:
+ * ------------------------------------------------
+ * QueryWorkspace<HeapNode*> ws(V);     // allocate once per graph
+ * ws.reset();                          // start a new query, O(1)
+ * ws.dist(v) / ws.parent(v) / ws.handle(v)
+ * ws.set_dist(v, d, p);                // write dist + parent (marks v seen)
+ * ws.set_handle(v, h);                 // v must already be seen
+ * ws.settled(v) / ws.settle(v);
+ */
+
+#ifndef QUERY_WORKSPACE_HPP
+#define QUERY_WORKSPACE_HPP
+
+#include <vector>
+#include <climits>
+#include <cstdint>
+#include <algorithm>
+#include "memoryTracker.hpp"
+
+template <typename Handle>
+struct QueryWorkspace {
+    int V;
+    WorkspaceVector<int> distance;
+    WorkspaceVector<int> parentOf;
+    WorkspaceVector<Handle> handles;
+    WorkspaceVector<uint32_t> seenEpoch;    // epoch in which distance/parentOf/handles were written
+    WorkspaceVector<uint32_t> settledEpoch; // epoch in which the vertex was settled
+    uint32_t epoch;
+
+    // Performance tracking
+    long long reset_count = 0;
+    int touched_count = 0; // vertices written during the current query
+
+    QueryWorkspace(int vertices)
+        : V(vertices),
+          distance(vertices),
+          parentOf(vertices),
+          handles(vertices),
+          seenEpoch(vertices, 0),
+          settledEpoch(vertices, 0),
+          epoch(1) {}
+
+    void reset() {
+        reset_count++;
+        touched_count = 0;
+        epoch++;
+
+        // Stamps wrapped around: clear them once every 2^32 queries.
+        if (epoch == 0) {
+            std::fill(seenEpoch.begin(), seenEpoch.end(), 0);
+            std::fill(settledEpoch.begin(), settledEpoch.end(), 0);
+            epoch = 1;
+        }
+    }
+
+    bool seen(int v) const { return seenEpoch[v] == epoch; }
+    bool settled(int v) const { return settledEpoch[v] == epoch; }
+
+    int dist(int v) const { return seen(v) ? distance[v] : INT_MAX; }
+    int parent(int v) const { return seen(v) ? parentOf[v] : -1; }
+    Handle handle(int v) const { return seen(v) ? handles[v] : Handle(); }
+
+    void set_dist(int v, int d, int p) {
+        if (!seen(v)) {
+            seenEpoch[v] = epoch;
+            handles[v] = Handle();
+            touched_count++;
+        }
+        distance[v] = d;
+        parentOf[v] = p;
+    }
+
+    void set_handle(int v, Handle h) {
+        handles[v] = h;
+    }
+
+    void settle(int v) {
+        settledEpoch[v] = epoch;
+    }
+};
+
+#endif // QUERY_WORKSPACE_HPP
@@ -0,0 +1,50 @@
+#!/bin/sh
+#
+# HEAP REPLAY TEST
+# Records a heap trace from every tracing driver (dijkstraTest,
+# PrimsHeapImplementation) and replays each trace through all four heap
+# backends. Fails if a replay crashes or any backend extracts a different
+# item than the trace expects.
+#
+# Usage: ./testHeapReplay.sh [work_dir]
+#   CXX and CXXFLAGS override the compiler and flags.
+
+set -e
+
+cd "$(dirname "$0")"
+work=${1:-$(mktemp -d)}
+mkdir -p "$work"
+CXX=${CXX:-g++}
+CXXFLAGS=${CXXFLAGS:--std=c++17 -O2 -pthread}
+
+# dijkstraTest includes "binomial_heap.hpp", which only resolves on
+# case-insensitive file systems
+mkdir -p "$work/include"
+ln -sf "$PWD/Binomial_Heap.hpp" "$work/include/binomial_heap.hpp"
+for prog in dijkstraTest PrimsHeapImplementation heapReplay; do
+    $CXX $CXXFLAGS -I. -I"$work/include" "$prog.cpp" -o "$work/$prog"
+done
+
+rm -f "$work"/trace_*.htrc
+"$work/dijkstraTest" "$work/trace" > /dev/null
+"$work/PrimsHeapImplementation" "$work/trace" > /dev/null
+
+failed=0
+count=0
+for trace in "$work"/trace_*.htrc; do
+    count=$((count + 1))
+    if "$work/heapReplay" "$trace" all 1 > "$trace.out" 2>&1; then
+        echo "ok    $(basename "$trace")"
+    else
+        echo "FAIL  $(basename "$trace")"
+        cat "$trace.out"
+        failed=$((failed + 1))
+    fi
+done
+
+if [ "$count" -eq 0 ]; then
+    echo "no traces were recorded"
+    exit 1
+fi
+echo "$((count - failed)) of $count traces replayed on every backend"
+[ "$failed" -eq 0 ]